@@ -0,0 +1,197 @@
+#ifndef BETWEENNESS_H
+#define BETWEENNESS_H
+
+#include <cstddef>
+#include <vector>
+#include <cmath> /* para log, sqrt y ceil */
+#include <ctime> /* para clock */
+#include "../CsrView.hpp"
+#include "../NonDirectedGraph.hpp"
+#include "IndexedHeap.hpp"
+#include "LiveIndices.hpp"
+
+/* parametros de la centralidad de intermediacion */
+struct BetweennessOptions {
+    bool weighted; /* caminos minimos por peso (dijkstra) en lugar de por cantidad de aristas (bfs) */
+    int samples; /* origenes muestreados al azar; 0 (o tantos como vertices) calcula el valor exacto */
+    double confidence; /* probabilidad con la que vale errorBound en el modo aproximado */
+    unsigned long seed; /* semilla del muestreo, para repetir resultados */
+    bool normalized; /* divide por (n - 1)(n - 2) / 2, los pares de vertices que no contienen a cada uno */
+
+    BetweennessOptions() : weighted(false), samples(0), confidence(0.95), seed(1), normalized(false) {}
+};
+
+/* centralidad de intermediacion, indexada por los indices internos del grafo */
+struct BetweennessResult {
+    std::vector<double> centrality; /* suma sobre los pares {s, t} de la fraccion de caminos minimos que pasan por cada indice */
+    std::vector<int> sources; /* origenes recorridos */
+    bool sampled; /* indica si el resultado es una estimacion por muestreo */
+    double errorBound; /* cota del error absoluto del valor normalizado de cada vertice, con la confianza pedida (0 si es exacto) */
+    double seconds; /* tiempo de procesador */
+
+    BetweennessResult() : sampled(false), errorBound(0), seconds(0) {}
+};
+
+/* origenes necesarios para que el error normalizado de todos los vertices quede por debajo de epsilon con la
+confianza indicada: por la desigualdad de hoeffding (que vale tambien muestreando sin reposicion) y la cota de
+la union sobre los n vertices, k = ln(2n / (1 - confianza)) / (2 e^2) con e = epsilon (n - 1) / n */
+inline int betweennessSamples(double epsilon, int vertices, double confidence = 0.95) {
+    if (vertices < 2 || epsilon <= 0.0) return 0;
+    double e = epsilon * (vertices - 1.0) / vertices;
+    double k = std::ceil(std::log(2.0 * vertices / (1.0 - confidence)) / (2.0 * e * e));
+    return k < vertices ? static_cast<int>(k) : vertices;
+}
+
+/* metodo auxiliar: estado de un recorrido de brandes, reutilizado entre origenes
+solo se reinician las posiciones que el recorrido anterior visito (las que quedaron en order) */
+struct BrandesWorkspace {
+    std::vector<double> distance; /* distancia desde el origen, -1 si no se alcanzo */
+    std::vector<double> paths; /* cantidad de caminos minimos desde el origen (sigma) */
+    std::vector<double> dependency; /* dependencia del origen en cada vertice (delta), el acumulador por origen */
+    std::vector<int> order; /* vertices alcanzados en orden de distancia no decreciente */
+    IndexedHeap<double> heap;
+
+    explicit BrandesWorkspace(int slots)
+        : distance(slots, -1.0), paths(slots, 0.0), dependency(slots, 0.0), heap(slots) {
+        order.reserve(slots);
+    }
+
+    void reset() {
+        for (std::size_t i = 0; i < order.size(); i++) {
+            int v = order[i];
+            distance[v] = -1.0;
+            paths[v] = 0.0;
+            dependency[v] = 0.0;
+        }
+        order.clear();
+    }
+};
+
+/* metodo auxiliar: caminos minimos desde source contando cuantos llegan a cada vertice, luego acumula las
+dependencias recorriendo los vertices de mas lejano a mas cercano y las suma a centrality.
+los predecesores no se guardan: v precede a w si distance[v] + peso(v, w) == distance[w], que repite
+exactamente la suma con la que se fijo la distancia porque la fila de w tiene el mismo peso que la de v */
+inline void brandesFrom(const CsrView& view, int source, bool weighted, BrandesWorkspace& work,
+                        std::vector<double>& centrality) {
+    work.reset();
+    work.distance[source] = 0.0;
+    work.paths[source] = 1.0;
+    if (!weighted) {
+        /* bfs: el propio vector order hace de cola */
+        work.order.push_back(source);
+        for (std::size_t head = 0; head < work.order.size(); head++) {
+            int u = work.order[head];
+            double next = work.distance[u] + 1.0;
+            for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+                int v = view.target(e);
+                if (work.distance[v] < 0.0) {
+                    work.distance[v] = next;
+                    work.order.push_back(v);
+                }
+                if (work.distance[v] == next) work.paths[v] += work.paths[u];
+            }
+        }
+    } else {
+        /* dijkstra: un vertice entra en order al salir del monticulo, con su distancia definitiva */
+        work.heap.push(source, 0.0);
+        while (!work.heap.empty()) {
+            int u = work.heap.pop();
+            work.order.push_back(u);
+            double base = work.distance[u];
+            for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+                int v = view.target(e);
+                double candidate = base + view.weight(e);
+                if (work.distance[v] < 0.0 || candidate < work.distance[v]) {
+                    work.distance[v] = candidate;
+                    work.paths[v] = work.paths[u];
+                    work.heap.pushOrDecrease(v, candidate);
+                } else if (candidate == work.distance[v]) {
+                    work.paths[v] += work.paths[u];
+                }
+            }
+        }
+    }
+    /* acumulacion: delta(v) = suma sobre los sucesores w de sigma(v) / sigma(w) (1 + delta(w)) */
+    for (std::size_t i = work.order.size(); i-- > 1;) {
+        int w = work.order[i];
+        double share = (1.0 + work.dependency[w]) / work.paths[w];
+        double distance = work.distance[w];
+        for (int e = view.edgeBegin(w); e < view.edgeEnd(w); e++) {
+            int v = view.target(e);
+            if (work.distance[v] >= 0.0 && work.distance[v] + (weighted ? view.weight(e) : 1.0) == distance) {
+                work.dependency[v] += work.paths[v] * share;
+            }
+        }
+        centrality[w] += work.dependency[w];
+    }
+    /* complejidad: o(n + m) sin pesos, o((n + m) log_d n) con pesos, sobre la parte alcanzada */
+}
+
+/* centralidad de intermediacion por el algoritmo de brandes: un recorrido por origen con acumulacion de
+dependencias, o(n m) en total sin pesos. con options.samples > 0 recorre solo esa cantidad de origenes
+elegidos al azar sin reposicion y escala el resultado por n / k, lo que da una estimacion sin sesgo.
+isLive decide que indices de la instantanea corresponden a vertices
+NOTA: la adyacencia debe ser simetrica (grafo no dirigido) y, con pesos, los pesos deben ser positivos */
+template <typename LivePredicate>
+BetweennessResult betweennessCentrality(const CsrView& view, LivePredicate isLive,
+                                        const BetweennessOptions& options = BetweennessOptions()) {
+    std::clock_t start = std::clock();
+    BetweennessResult result;
+    int slots = view.getVertexSlots();
+    result.centrality.assign(slots, 0.0);
+    std::vector<int> live;
+    for (int v = 0; v < slots; v++) {
+        if (isLive(v)) live.push_back(v);
+    }
+    int n = static_cast<int>(live.size());
+    if (n == 0) return result;
+
+    int k = options.samples > 0 && options.samples < n ? options.samples : n;
+    result.sampled = k < n;
+    if (result.sampled) {
+        /* fisher-yates parcial: los primeros k del arreglo quedan elegidos al azar */
+        /* congruencial de 32 bits (unsigned long tiene al menos 32): da la misma secuencia en cualquier plataforma;
+        cada paso aporta sus 15 bits altos y dos pasos seguidos forman un numero de 30 bits */
+        unsigned long state = options.seed & 0xffffffffUL;
+        for (int i = 0; i < k; i++) {
+            state = (state * 1103515245UL + 12345UL) & 0xffffffffUL;
+            unsigned long draw = (state >> 16) & 0x7fffUL;
+            state = (state * 1103515245UL + 12345UL) & 0xffffffffUL;
+            draw = (draw << 15) | ((state >> 16) & 0x7fffUL);
+            int j = i + static_cast<int>(draw % static_cast<unsigned long>(n - i));
+            int swap = live[i];
+            live[i] = live[j];
+            live[j] = swap;
+        }
+        live.resize(k);
+    }
+    result.sources = live;
+
+    BrandesWorkspace work(slots);
+    for (int i = 0; i < k; i++) {
+        brandesFrom(view, live[i], options.weighted, work, result.centrality);
+    }
+
+    /* cada par {s, t} se cuenta desde s y desde t */
+    double scale = 0.5 * n / k;
+    if (options.normalized) scale = n > 2 ? scale / ((n - 1.0) * (n - 2.0) / 2.0) : 0.0;
+    for (int v = 0; v < slots; v++) result.centrality[v] *= scale;
+    if (result.sampled) {
+        result.errorBound = n / (n - 1.0) * std::sqrt(std::log(2.0 * n / (1.0 - options.confidence)) / (2.0 * k));
+    }
+    result.seconds = static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+    return result;
+    /* complejidad: o(k (n + m)) sin pesos, o(k (n + m) log_d n) con pesos */
+}
+
+/* centralidad de intermediacion de un grafo no dirigido a partir de su instantanea csr; con options.weighted
+los caminos minimos usan los pesos de las aristas */
+template <typename T, typename W>
+BetweennessResult betweennessCentrality(NonDirectedGraph<T, W>& graph,
+                                        const BetweennessOptions& options = BetweennessOptions()) {
+    const CsrView& view = graph.freeze();
+    return betweennessCentrality(view, GraphIndexLive<T, W>(graph), options);
+    /* complejidad: o(k (n + m)) sin pesos mas la construccion de la instantanea si el grafo cambio */
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef BITSET_H
+#define BITSET_H
+
+#include <cstddef>
+#include <vector>
+#include <climits> /* para CHAR_BIT */
+
+/* cuenta los bits encendidos de una palabra */
+inline int popCount(unsigned long word) {
+#ifdef __GNUC__
+    return __builtin_popcountl(word);
+#else
+    /* conteo por grupos de bits (swar) para compiladores sin la instruccion intrinseca: suma pares, luego
+    grupos de 4 y de 8 bits, y acumula los bytes con una multiplicacion; las mascaras se arman con ~0UL para
+    servir a palabras de 32 y de 64 bits */
+    const unsigned long m1 = ~0UL / 3UL; /* 0x5555... */
+    const unsigned long m2 = ~0UL / 5UL; /* 0x3333... */
+    const unsigned long m4 = ~0UL / 17UL; /* 0x0f0f... */
+    const unsigned long h01 = ~0UL / 255UL; /* 0x0101... */
+    word = word - ((word >> 1) & m1);
+    word = (word & m2) + ((word >> 2) & m2);
+    word = (word + (word >> 4)) & m4;
+    return static_cast<int>((word * h01) >> ((sizeof(unsigned long) - 1) * CHAR_BIT));
+#endif
+    /* complejidad: o(1) */
+}
+
+/* posicion del bit encendido mas bajo de una palabra distinta de cero */
+inline int lowestBit(unsigned long word) {
+#ifdef __GNUC__
+    return __builtin_ctzl(word);
+#else
+    int position = 0;
+    while ((word & 1UL) == 0) {
+        word >>= 1;
+        position++;
+    }
+    return position;
+#endif
+    /* complejidad: o(1) */
+}
+
+/* conjunto de bits de tamaño fijo almacenado en palabras contiguas
+lo usan los algoritmos para marcar vertices por su indice interno (fronteras, visitados) */
+class Bitset {
+private:
+    std::vector<unsigned long> words; /* palabras del conjunto, el bit i esta en words[i / bitsPerWord()] */
+    int bitCount; /* numero de bits del conjunto */
+
+public:
+    /* bits por palabra */
+    static int bitsPerWord() { return static_cast<int>(sizeof(unsigned long) * CHAR_BIT); }
+
+    Bitset() : bitCount(0) {}
+    explicit Bitset(int bits) : words((bits + bitsPerWord() - 1) / bitsPerWord(), 0UL), bitCount(bits) {}
+
+    /* cambia el tamaño del conjunto y apaga todos los bits */
+    void assign(int bits) {
+        words.assign((bits + bitsPerWord() - 1) / bitsPerWord(), 0UL);
+        bitCount = bits;
+    }
+
+    int size() const { return bitCount; }
+    int getWordCount() const { return static_cast<int>(words.size()); }
+
+    bool test(int bit) const {
+        return (words[bit / bitsPerWord()] >> (bit % bitsPerWord())) & 1UL;
+    }
+    void set(int bit) {
+        words[bit / bitsPerWord()] |= 1UL << (bit % bitsPerWord());
+    }
+    void reset(int bit) {
+        words[bit / bitsPerWord()] &= ~(1UL << (bit % bitsPerWord()));
+    }
+
+    /* apaga todos los bits sin liberar la memoria */
+    void clear() {
+        for (std::size_t i = 0; i < words.size(); i++) {
+            words[i] = 0UL;
+        }
+        /* complejidad: o(bits / bitsPerWord()) */
+    }
+
+    /* numero de bits encendidos */
+    int count() const {
+        int total = 0;
+        for (std::size_t i = 0; i < words.size(); i++) {
+            total += popCount(words[i]);
+        }
+        return total;
+        /* complejidad: o(bits / bitsPerWord()) */
+    }
+
+    /* acceso a las palabras para las operaciones que trabajan de a bloques */
+    unsigned long getWord(int word) const { return words[word]; }
+    void setWord(int word, unsigned long value) { words[word] = value; }
+
+    void swap(Bitset& other) {
+        words.swap(other.words);
+        int bits = bitCount;
+        bitCount = other.bitCount;
+        other.bitCount = bits;
+    }
+};
+
+#endif
@@ -0,0 +1,153 @@
+#ifndef BREADTHFIRSTSEARCH_H
+#define BREADTHFIRSTSEARCH_H
+
+#include <vector>
+#include "../CsrView.hpp"
+#include "../CompressedAdjacency.hpp"
+#include "../NonDirectedGraph.hpp"
+#include "Bitset.hpp"
+
+/* resultado de un recorrido en anchura, indexado por los indices internos del grafo */
+struct BfsResult {
+    std::vector<int> distance; /* nivel de cada vertice desde el origen, -1 si no se alcanzo */
+    std::vector<int> parent; /* padre en el arbol del recorrido, -1 para el origen y los no alcanzados */
+    int reached; /* numero de vertices alcanzados (incluye el origen) */
+    int levels; /* numero de niveles recorridos */
+    int topDownSteps; /* niveles expandidos desde la frontera (descendente) */
+    int bottomUpSteps; /* niveles expandidos desde los no visitados (ascendente) */
+
+    BfsResult() : reached(0), levels(0), topDownSteps(0), bottomUpSteps(0) {}
+};
+
+/* parametros por defecto del cambio de direccion (beamer et al.): se pasa a ascendente cuando las aristas
+de la frontera superan 1/alpha de las aristas sin explorar, y se vuelve a descendente cuando la frontera
+tiene menos de 1/beta de los vertices */
+const int bfsDefaultAlpha = 15;
+const int bfsDefaultBeta = 18;
+
+/* recorrido en anchura con optimizacion de direccion sobre una instantanea csr
+cada nivel se expande de forma descendente (frontera -> vecinos) o ascendente (cada vertice no visitado
+busca un padre en la frontera, marcada en un mapa de bits), segun cuantas aristas quedan por explorar
+NOTA: el paso ascendente recorre las filas como aristas entrantes, por lo que la adyacencia debe ser simetrica
+(grafo no dirigido); alpha <= 0 desactiva el paso ascendente y deja un recorrido descendente clasico
+Adjacency es CsrView o CompressedAdjacency: los vecinos se recorren con su RowCursor */
+template <typename Adjacency>
+BfsResult directionOptimizingBfs(const Adjacency& view, int source, int alpha, int beta) {
+    BfsResult result;
+    int slots = view.getVertexSlots();
+    result.distance.assign(slots, -1);
+    result.parent.assign(slots, -1);
+    if (!view.containsIndex(source)) return result;
+
+    std::vector<int> frontier; /* frontera actual como lista de indices */
+    std::vector<int> next; /* frontera del siguiente nivel */
+    Bitset frontierBits; /* frontera actual como mapa de bits, solo durante los pasos ascendentes */
+    Bitset nextBits;
+    bool bitsReady = false; /* indica si frontierBits corresponde a la frontera actual */
+    bool bottomUp = false;
+
+    result.distance[source] = 0;
+    result.reached = 1;
+    frontier.push_back(source);
+    long scoutEdges = view.degree(source); /* aristas que salen de la frontera */
+    long uncheckedEdges = view.getEntryCount() - scoutEdges; /* aristas de los vertices no visitados */
+
+    while (!frontier.empty()) {
+        /* elige la direccion del nivel */
+        if (!bottomUp) {
+            bottomUp = alpha > 0 && scoutEdges * alpha > uncheckedEdges;
+        } else {
+            bottomUp = static_cast<long>(frontier.size()) * beta >= slots;
+        }
+
+        int level = result.levels + 1;
+        scoutEdges = 0;
+        next.clear();
+        if (bottomUp) {
+            if (frontierBits.size() != slots) {
+                frontierBits.assign(slots);
+                nextBits.assign(slots);
+            }
+            /* la frontera venia en forma de lista: la vuelca al mapa de bits */
+            if (!bitsReady) {
+                frontierBits.clear();
+                for (std::size_t i = 0; i < frontier.size(); i++) {
+                    frontierBits.set(frontier[i]);
+                }
+            }
+            nextBits.clear();
+            /* cada vertice no visitado busca un vecino en la frontera y se detiene en el primero */
+            for (int v = 0; v < slots; v++) {
+                if (result.distance[v] >= 0) continue;
+                typename Adjacency::RowCursor cursor(view, v);
+                int u;
+                while (cursor.next(u)) {
+                    if (frontierBits.test(u)) {
+                        result.distance[v] = level;
+                        result.parent[v] = u;
+                        nextBits.set(v);
+                        next.push_back(v);
+                        scoutEdges += view.degree(v);
+                        break;
+                    }
+                }
+            }
+            frontierBits.swap(nextBits);
+            bitsReady = true;
+            result.bottomUpSteps++;
+        } else {
+            /* expande cada vertice de la frontera hacia sus vecinos no visitados
+            el grado de cada vertice descubierto solo sirve para elegir la direccion: sin paso ascendente no se
+            consulta, lo que ahorra un acceso aleatorio por vertice (dos en la adyacencia comprimida) */
+            bool countScout = alpha > 0;
+            for (std::size_t i = 0; i < frontier.size(); i++) {
+                int u = frontier[i];
+                typename Adjacency::RowCursor cursor(view, u);
+                int v;
+                while (cursor.next(v)) {
+                    if (result.distance[v] < 0) {
+                        result.distance[v] = level;
+                        result.parent[v] = u;
+                        next.push_back(v);
+                        if (countScout) scoutEdges += view.degree(v);
+                    }
+                }
+            }
+            bitsReady = false;
+            result.topDownSteps++;
+        }
+
+        uncheckedEdges -= scoutEdges;
+        result.reached += static_cast<int>(next.size());
+        if (!next.empty()) result.levels = level;
+        frontier.swap(next);
+    }
+    return result;
+    /* complejidad promedio: o(n + m), con menos aristas inspeccionadas en los niveles ascendentes */
+    /* complejidad peor caso: o(n * niveles + m) */
+}
+
+/* recorrido en anchura sobre una instantanea csr (ver directionOptimizingBfs) */
+inline BfsResult breadthFirstSearch(const CsrView& view, int source,
+                                    int alpha = bfsDefaultAlpha, int beta = bfsDefaultBeta) {
+    return directionOptimizingBfs(view, source, alpha, beta);
+}
+
+/* recorrido en anchura sobre una adyacencia comprimida: mismo algoritmo, decodificando cada fila al recorrerla */
+inline BfsResult breadthFirstSearch(const CompressedAdjacency& adjacency, int source,
+                                    int alpha = bfsDefaultAlpha, int beta = bfsDefaultBeta) {
+    return directionOptimizingBfs(adjacency, source, alpha, beta);
+}
+
+/* recorrido en anchura desde el vertice con el dato indicado
+congela el grafo para recorrer su instantanea csr; los vectores del resultado se indexan con getIndexByData
+y, si el origen no existe, todos los vertices quedan sin alcanzar */
+template <typename T, typename W>
+BfsResult breadthFirstSearch(NonDirectedGraph<T, W>& graph, const T& source,
+                             int alpha = bfsDefaultAlpha, int beta = bfsDefaultBeta) {
+    const CsrView& view = graph.freeze();
+    return breadthFirstSearch(view, graph.getIndexByData(source), alpha, beta);
+    /* complejidad promedio: o(n + m) mas la construccion de la instantanea si el grafo cambio */
+}
+
+#endif
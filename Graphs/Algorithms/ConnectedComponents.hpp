@@ -0,0 +1,63 @@
+#ifndef CONNECTEDCOMPONENTS_H
+#define CONNECTEDCOMPONENTS_H
+
+#include <vector>
+#include "../CsrView.hpp"
+#include "../Graph.hpp"
+#include "UnionFind.hpp"
+#include "LiveIndices.hpp"
+
+/* componentes conexas de un grafo, indexadas por los indices internos */
+struct ComponentResult {
+    std::vector<int> label; /* componente de cada indice (0..count-1), -1 para los indices sin vertice */
+    std::vector<int> sizes; /* numero de vertices de cada componente */
+    int count; /* numero de componentes */
+
+    ComponentResult() : count(0) {}
+};
+
+/* componentes conexas con conjuntos disjuntos: une los extremos de cada arista y numera las raices
+en el orden del primer indice de cada componente. en un grafo dirigido calcula las componentes
+debilmente conexas. isLive decide que indices de la instantanea corresponden a vertices */
+template <typename LivePredicate>
+ComponentResult connectedComponents(const CsrView& view, LivePredicate isLive) {
+    ComponentResult result;
+    int slots = view.getVertexSlots();
+    UnionFind sets(slots);
+    for (int v = 0; v < slots; v++) {
+        int end = view.edgeEnd(v);
+        for (int e = view.edgeBegin(v); e < end; e++) {
+            sets.unite(v, view.target(e));
+        }
+    }
+
+    /* numera las componentes: la primera vez que aparece una raiz recibe la siguiente etiqueta */
+    std::vector<int> rootLabel(slots, -1);
+    result.label.assign(slots, -1);
+    for (int v = 0; v < slots; v++) {
+        if (!isLive(v)) continue;
+        int root = sets.find(v);
+        if (rootLabel[root] < 0) {
+            rootLabel[root] = result.count++;
+            result.sizes.push_back(0);
+        }
+        result.label[v] = rootLabel[root];
+        result.sizes[rootLabel[root]]++;
+    }
+    return result;
+    /* complejidad: o((n + m) alfa(n)) */
+}
+
+inline ComponentResult connectedComponents(const CsrView& view) {
+    return connectedComponents(view, AllIndicesLive());
+}
+
+/* componentes conexas de un grafo a partir de su instantanea csr */
+template <typename T, typename W>
+ComponentResult connectedComponents(Graph<T, W>& graph) {
+    const CsrView& view = graph.freeze();
+    return connectedComponents(view, GraphIndexLive<T, W>(graph));
+    /* complejidad: o((n + m) alfa(n)) mas la construccion de la instantanea si el grafo cambio */
+}
+
+#endif
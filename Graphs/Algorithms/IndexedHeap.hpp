@@ -0,0 +1,130 @@
+#ifndef INDEXEDHEAP_H
+#define INDEXEDHEAP_H
+
+#include <cstddef>
+#include <vector>
+
+/* monticulo d-ario de minimos sobre indices enteros [0, capacidad) con disminucion de clave
+cada indice aparece a lo sumo una vez; position permite encontrarlo en o(1) para disminuir su clave
+un arity mayor que 2 acorta el arbol y abarata las disminuciones, que son la operacion mas frecuente
+en los algoritmos de caminos minimos */
+template <typename K, int D = 4>
+class IndexedHeap {
+private:
+    std::vector<int> heap; /* indices ordenados como monticulo */
+    std::vector<K> keys; /* clave de cada indice */
+    std::vector<int> position; /* posicion de cada indice dentro de heap, -1 si no esta */
+
+    /* sube el elemento de una posicion mientras su clave sea menor que la de su padre */
+    void siftUp(int pos) {
+        int item = heap[pos];
+        K key = keys[item];
+        while (pos > 0) {
+            int parent = (pos - 1) / D;
+            if (!(key < keys[heap[parent]])) break;
+            heap[pos] = heap[parent];
+            position[heap[pos]] = pos;
+            pos = parent;
+        }
+        heap[pos] = item;
+        position[item] = pos;
+        /* complejidad: o(log_d n) */
+    }
+
+    /* baja el elemento de una posicion mientras algun hijo tenga una clave menor */
+    void siftDown(int pos) {
+        int count = static_cast<int>(heap.size());
+        int item = heap[pos];
+        K key = keys[item];
+        while (true) {
+            int first = pos * D + 1;
+            if (first >= count) break;
+            int last = first + D < count ? first + D : count;
+            int best = first;
+            for (int child = first + 1; child < last; child++) {
+                if (keys[heap[child]] < keys[heap[best]]) best = child;
+            }
+            if (!(keys[heap[best]] < key)) break;
+            heap[pos] = heap[best];
+            position[heap[pos]] = pos;
+            pos = best;
+        }
+        heap[pos] = item;
+        position[item] = pos;
+        /* complejidad: o(d log_d n) */
+    }
+
+public:
+    IndexedHeap() {}
+    explicit IndexedHeap(int capacity) : keys(capacity), position(capacity, -1) {}
+
+    /* vacia el monticulo y lo prepara para indices en [0, capacity) */
+    void assign(int capacity) {
+        heap.clear();
+        keys.assign(capacity, K());
+        position.assign(capacity, -1);
+    }
+
+    int capacity() const { return static_cast<int>(position.size()); }
+    int size() const { return static_cast<int>(heap.size()); }
+    bool empty() const { return heap.empty(); }
+    bool contains(int index) const { return position[index] >= 0; }
+    K getKey(int index) const { return keys[index]; }
+
+    /* agrega un indice que no esta en el monticulo */
+    void push(int index, K key) {
+        keys[index] = key;
+        position[index] = static_cast<int>(heap.size());
+        heap.push_back(index);
+        siftUp(position[index]);
+        /* complejidad: o(log_d n) */
+    }
+
+    /* disminuye la clave de un indice que ya esta en el monticulo */
+    void decreaseKey(int index, K key) {
+        keys[index] = key;
+        siftUp(position[index]);
+        /* complejidad: o(log_d n) */
+    }
+
+    /* agrega el indice o disminuye su clave; retorna false si la clave actual ya era menor o igual */
+    bool pushOrDecrease(int index, K key) {
+        if (!contains(index)) {
+            push(index, key);
+            return true;
+        }
+        if (!(key < keys[index])) return false;
+        decreaseKey(index, key);
+        return true;
+        /* complejidad: o(log_d n) */
+    }
+
+    /* indice y clave del minimo (el monticulo no debe estar vacio) */
+    int top() const { return heap[0]; }
+    K topKey() const { return keys[heap[0]]; }
+
+    /* extrae el indice de clave minima */
+    int pop() {
+        int item = heap[0];
+        position[item] = -1;
+        int last = heap.back();
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = last;
+            siftDown(0);
+        }
+        return item;
+        /* complejidad: o(d log_d n) */
+    }
+
+    /* vacia el monticulo visitando solo los elementos que quedan, sin recorrer toda la capacidad */
+    void clear() {
+        for (std::size_t i = 0; i < heap.size(); i++) {
+            position[heap[i]] = -1;
+        }
+        heap.clear();
+        /* complejidad: o(elementos en el monticulo) */
+    }
+};
+
+#endif
@@ -0,0 +1,19 @@
+#ifndef LIVEINDICES_H
+#define LIVEINDICES_H
+
+#include "../Graph.hpp"
+
+/* predicado que acepta todos los indices de la instantanea */
+struct AllIndicesLive {
+    bool operator()(int) const { return true; }
+};
+
+/* predicado que acepta solo los indices ocupados de un grafo (descarta las lapidas de vertices eliminados) */
+template <typename T, typename W = double>
+struct GraphIndexLive {
+    const Graph<T, W>* graph;
+    explicit GraphIndexLive(const Graph<T, W>& newGraph) : graph(&newGraph) {}
+    bool operator()(int index) const { return graph->containsVertexByIndex(index); }
+};
+
+#endif
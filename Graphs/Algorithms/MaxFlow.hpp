@@ -0,0 +1,371 @@
+#ifndef MAXFLOW_H
+#define MAXFLOW_H
+
+#include <cstddef>
+#include <vector>
+#include <ctime> /* para clock */
+#include "../CsrView.hpp"
+#include "../Graph.hpp"
+#include "../NonDirectedGraph.hpp"
+
+/* red residual con arcos en arreglos paralelos agrupados por vertice de origen (estrella directa)
+cada arco tiene un arco inverso en la fila de su destino; empujar flujo por un arco resta de su residual y
+suma al del inverso. en una red dirigida cada arista u -> v da el arco u -> v con su capacidad y un inverso
+v -> u de capacidad cero; en una simetrica (grafo no dirigido) cada arista da un solo par de arcos, u -> v y
+v -> u, los dos con la capacidad de la arista. los pesos de la instantanea son las capacidades y los lazos
+se ignoran. la red se construye una vez y sirve para varias consultas */
+class ResidualNetwork {
+private:
+    std::vector<int> arcStart; /* arcStart[v]..arcStart[v + 1] delimitan los arcos que salen de v */
+    std::vector<int> arcHead; /* destino de cada arco */
+    std::vector<int> arcReverse; /* posicion del arco inverso */
+    std::vector<double> arcCapacity; /* capacidad original */
+    std::vector<double> arcResidual; /* capacidad residual de la consulta actual */
+
+public:
+    ResidualNetwork() : arcStart(1, 0) {}
+
+    ResidualNetwork(const CsrView& view, bool symmetric) : arcStart(1, 0) {
+        build(view, symmetric);
+    }
+
+    /* construye la red a partir de una instantanea; con symmetric la instantanea debe tener cada arista en
+    las dos filas con el mismo peso y se usa la entrada de la fila del extremo menor */
+    void build(const CsrView& view, bool symmetric) {
+        int slots = view.getVertexSlots();
+        arcStart.assign(slots + 1, 0);
+        for (int u = 0; u < slots; u++) {
+            for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+                int v = view.target(e);
+                if (v == u || (symmetric && v < u)) continue;
+                arcStart[u + 1]++;
+                arcStart[v + 1]++;
+            }
+        }
+        for (int u = 0; u < slots; u++) {
+            arcStart[u + 1] += arcStart[u];
+        }
+        int arcs = arcStart[slots];
+        arcHead.assign(arcs, 0);
+        arcReverse.assign(arcs, 0);
+        arcCapacity.assign(arcs, 0.0);
+        std::vector<int> next(arcStart.begin(), arcStart.end() - 1);
+        for (int u = 0; u < slots; u++) {
+            for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+                int v = view.target(e);
+                if (v == u || (symmetric && v < u)) continue;
+                int forward = next[u]++;
+                int backward = next[v]++;
+                arcHead[forward] = v;
+                arcHead[backward] = u;
+                arcReverse[forward] = backward;
+                arcReverse[backward] = forward;
+                arcCapacity[forward] = view.weight(e);
+                arcCapacity[backward] = symmetric ? view.weight(e) : 0.0;
+            }
+        }
+        arcResidual = arcCapacity;
+        /* complejidad: o(n + m) */
+    }
+
+    int getVertexSlots() const { return static_cast<int>(arcStart.size()) - 1; }
+    int getArcCount() const { return static_cast<int>(arcHead.size()); }
+
+    /* vuelve los residuales a las capacidades originales (red sin flujo) */
+    void resetFlow() {
+        arcResidual = arcCapacity;
+    }
+
+    int arcBegin(int vertex) const { return arcStart[vertex]; }
+    int arcEnd(int vertex) const { return arcStart[vertex + 1]; }
+    int head(int arc) const { return arcHead[arc]; }
+    int reverse(int arc) const { return arcReverse[arc]; }
+    double capacity(int arc) const { return arcCapacity[arc]; }
+    double residual(int arc) const { return arcResidual[arc]; }
+
+    /* flujo neto por un arco: lo que se le resto a su capacidad */
+    double flow(int arc) const { return arcCapacity[arc] - arcResidual[arc]; }
+
+    /* mueve amount unidades de flujo por un arco */
+    void push(int arc, double amount) {
+        arcResidual[arc] -= amount;
+        arcResidual[arcReverse[arc]] += amount;
+    }
+
+    /* bytes ocupados por los arreglos de la red */
+    std::size_t getMemoryBytes() const {
+        return (arcStart.capacity() + arcHead.capacity() + arcReverse.capacity()) * sizeof(int)
+            + (arcCapacity.capacity() + arcResidual.capacity()) * sizeof(double);
+    }
+};
+
+/* arista del corte minimo, entre indices internos */
+struct CutEdge {
+    int source;
+    int destination;
+    double capacity;
+
+    CutEdge(int newSource, int newDestination, double newCapacity)
+        : source(newSource), destination(newDestination), capacity(newCapacity) {}
+};
+
+/* flujo maximo y corte minimo, indexados por los indices internos del grafo */
+struct MaxFlowResult {
+    double value; /* valor del flujo maximo, igual a la capacidad del corte minimo */
+    std::vector<bool> sourceSide; /* lado del origen del corte: los indices desde los que no se alcanza el sumidero en la red residual */
+    std::vector<CutEdge> cutEdges; /* arcos con capacidad del lado del origen al del sumidero */
+    long pushes; /* empujes realizados */
+    long relabels; /* reetiquetados de un vertice */
+    int globalRelabels; /* reetiquetados globales (bfs desde el sumidero) */
+    int gaps; /* veces que se aplico la heuristica de hueco */
+    double seconds; /* tiempo de procesador, sin construir la red */
+
+    MaxFlowResult() : value(0), pushes(0), relabels(0), globalRelabels(0), gaps(0), seconds(0) {}
+};
+
+/* metodo auxiliar: estado de push-relabel. las etiquetas son cotas inferiores de la distancia residual al
+sumidero; slots (n) significa que el sumidero no se alcanza. cada etiqueta tiene una pila de vertices activos
+(con exceso) y una lista doble con todos sus vertices, que permite aplicar el hueco */
+class PushRelabelState {
+private:
+    ResidualNetwork& network;
+    int n;
+    int source;
+    int sink;
+    std::vector<int> label;
+    std::vector<double> excess;
+    std::vector<int> current; /* siguiente arco por revisar de cada vertice */
+    std::vector<int> activeFirst; /* primer activo de cada etiqueta */
+    std::vector<int> activeNext;
+    std::vector<int> bucketFirst; /* primer vertice de cada etiqueta */
+    std::vector<int> bucketNext;
+    std::vector<int> bucketPrev;
+    std::vector<int> queue; /* cola del bfs del reetiquetado global */
+    int maxActive; /* mayor etiqueta que puede tener activos */
+    int maxLabel; /* mayor etiqueta ocupada por debajo de n */
+    long work; /* trabajo desde el ultimo reetiquetado global */
+    MaxFlowResult& result;
+
+    void addToBucket(int v) {
+        int d = label[v];
+        bucketPrev[v] = -1;
+        bucketNext[v] = bucketFirst[d];
+        if (bucketFirst[d] >= 0) bucketPrev[bucketFirst[d]] = v;
+        bucketFirst[d] = v;
+        if (d > maxLabel) maxLabel = d;
+    }
+
+    void removeFromBucket(int v) {
+        if (bucketPrev[v] >= 0) {
+            bucketNext[bucketPrev[v]] = bucketNext[v];
+        } else {
+            bucketFirst[label[v]] = bucketNext[v];
+        }
+        if (bucketNext[v] >= 0) bucketPrev[bucketNext[v]] = bucketPrev[v];
+    }
+
+    void activate(int v) {
+        activeNext[v] = activeFirst[label[v]];
+        activeFirst[label[v]] = v;
+        if (label[v] > maxActive) maxActive = label[v];
+    }
+
+    /* bfs inverso desde el sumidero por los arcos con residual: fija las etiquetas exactas y rearma las listas */
+    void globalRelabel() {
+        result.globalRelabels++;
+        work = 0;
+        for (int v = 0; v < n; v++) {
+            label[v] = n;
+            current[v] = network.arcBegin(v);
+        }
+        for (int d = 0; d <= n; d++) {
+            activeFirst[d] = -1;
+            bucketFirst[d] = -1;
+        }
+        maxActive = -1;
+        maxLabel = 0;
+        label[sink] = 0;
+        queue.clear();
+        queue.push_back(sink);
+        for (std::size_t head = 0; head < queue.size(); head++) {
+            int u = queue[head];
+            int next = label[u] + 1;
+            for (int a = network.arcBegin(u); a < network.arcEnd(u); a++) {
+                int v = network.head(a);
+                /* v alcanza a u si el arco v -> u (el inverso de a) tiene residual */
+                if (label[v] < n || v == source || network.residual(network.reverse(a)) <= 0.0) continue;
+                label[v] = next;
+                queue.push_back(v);
+                addToBucket(v);
+                if (excess[v] > 0.0) activate(v);
+            }
+        }
+        /* complejidad: o(n + m) */
+    }
+
+    /* hueco: si ningun vertice queda con la etiqueta d, los de etiqueta mayor ya no alcanzan el sumidero */
+    void gap(int d) {
+        result.gaps++;
+        for (int k = d + 1; k <= maxLabel; k++) {
+            for (int v = bucketFirst[k]; v >= 0; v = bucketNext[v]) label[v] = n;
+            bucketFirst[k] = -1;
+            activeFirst[k] = -1;
+        }
+        maxLabel = d - 1;
+        if (maxActive > maxLabel) maxActive = maxLabel;
+    }
+
+    /* etiqueta nueva: uno mas que el vecino residual de menor etiqueta; aplica el hueco si la anterior queda vacia */
+    void relabel(int v) {
+        result.relabels++;
+        int old = label[v];
+        removeFromBucket(v);
+        if (bucketFirst[old] < 0) {
+            label[v] = n;
+            gap(old);
+            return;
+        }
+        int lowest = n;
+        int arc = network.arcBegin(v);
+        for (int a = network.arcBegin(v); a < network.arcEnd(v); a++) {
+            if (network.residual(a) > 0.0 && label[network.head(a)] + 1 < lowest) {
+                lowest = label[network.head(a)] + 1;
+                arc = a;
+            }
+        }
+        work += 12 + network.arcEnd(v) - network.arcBegin(v);
+        label[v] = lowest;
+        current[v] = arc;
+        if (lowest < n) addToBucket(v);
+    }
+
+    /* empuja el exceso de v por sus arcos admisibles (residual y etiqueta una menor) hasta agotarlo o reetiquetar */
+    void discharge(int v) {
+        while (excess[v] > 0.0 && label[v] < n) {
+            int end = network.arcEnd(v);
+            int d = label[v] - 1;
+            int a = current[v];
+            for (; a < end; a++) {
+                int w = network.head(a);
+                double residual = network.residual(a);
+                if (residual <= 0.0 || label[w] != d) continue;
+                double amount = excess[v] < residual ? excess[v] : residual;
+                network.push(a, amount);
+                result.pushes++;
+                excess[v] -= amount;
+                if (excess[w] <= 0.0 && w != sink) activate(w);
+                excess[w] += amount;
+                if (excess[v] <= 0.0) break;
+            }
+            current[v] = a < end ? a : end;
+            if (excess[v] > 0.0) relabel(v);
+        }
+    }
+
+public:
+    PushRelabelState(ResidualNetwork& newNetwork, int newSource, int newSink, MaxFlowResult& newResult)
+        : network(newNetwork), n(newNetwork.getVertexSlots()), source(newSource), sink(newSink),
+          label(n, 0), excess(n, 0.0), current(n, 0), activeFirst(n + 1, -1), activeNext(n, -1),
+          bucketFirst(n + 1, -1), bucketNext(n, -1), bucketPrev(n, -1), maxActive(-1), maxLabel(0), work(0),
+          result(newResult) {
+        queue.reserve(n);
+    }
+
+    /* primera fase de push-relabel por la etiqueta mas alta: termina con un preflujo maximo, cuyo exceso en el
+    sumidero es el valor del flujo maximo (no hace falta devolver el exceso restante al origen para el corte) */
+    double run() {
+        for (int a = network.arcBegin(source); a < network.arcEnd(source); a++) {
+            double residual = network.residual(a);
+            if (residual <= 0.0) continue;
+            network.push(a, residual);
+            excess[network.head(a)] += residual;
+            excess[source] -= residual;
+        }
+        globalRelabel();
+        /* el reetiquetado global se repite cuando el trabajo local supera o(n + m) */
+        long threshold = 6L * n + network.getArcCount() / 2;
+        while (maxActive >= 0) {
+            int v = activeFirst[maxActive];
+            if (v < 0) {
+                maxActive--;
+                continue;
+            }
+            activeFirst[maxActive] = activeNext[v];
+            discharge(v);
+            if (work > threshold) globalRelabel();
+        }
+        return excess[sink];
+        /* complejidad: o(n^2 raiz(m)) en el peor caso */
+    }
+
+    /* lado del origen del corte minimo: los vertices que no alcanzan el sumidero por arcos con residual */
+    void minimumCut(std::vector<bool>& sourceSide) {
+        std::vector<bool> reachesSink(n, false);
+        reachesSink[sink] = true;
+        queue.clear();
+        queue.push_back(sink);
+        for (std::size_t head = 0; head < queue.size(); head++) {
+            int u = queue[head];
+            for (int a = network.arcBegin(u); a < network.arcEnd(u); a++) {
+                int v = network.head(a);
+                if (reachesSink[v] || network.residual(network.reverse(a)) <= 0.0) continue;
+                reachesSink[v] = true;
+                queue.push_back(v);
+            }
+        }
+        sourceSide.assign(n, false);
+        for (int v = 0; v < n; v++) sourceSide[v] = !reachesSink[v];
+        /* complejidad: o(n + m) */
+    }
+};
+
+/* flujo maximo de source a sink por push-relabel con la etiqueta mas alta primero, reetiquetado global
+periodico y heuristica de hueco; tambien calcula el corte minimo. los residuales de la red quedan con el
+preflujo final y se reinician al empezar, asi que la misma red sirve para varias consultas */
+inline MaxFlowResult maxFlow(ResidualNetwork& network, int source, int sink) {
+    std::clock_t start = std::clock();
+    MaxFlowResult result;
+    int slots = network.getVertexSlots();
+    if (source < 0 || sink < 0 || source >= slots || sink >= slots || source == sink) return result;
+    network.resetFlow();
+    PushRelabelState state(network, source, sink, result);
+    result.value = state.run();
+    state.minimumCut(result.sourceSide);
+    for (int u = 0; u < slots; u++) {
+        if (!result.sourceSide[u]) continue;
+        for (int a = network.arcBegin(u); a < network.arcEnd(u); a++) {
+            int v = network.head(a);
+            if (!result.sourceSide[v] && network.capacity(a) > 0.0) result.cutEdges.push_back(CutEdge(u, v, network.capacity(a)));
+        }
+    }
+    result.seconds = static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+    return result;
+    /* complejidad: o(n^2 raiz(m)) en el peor caso, en la practica cerca de lineal con las dos heuristicas */
+}
+
+/* flujo maximo sobre una instantanea csr (symmetric para la de un grafo no dirigido) */
+inline MaxFlowResult maxFlow(const CsrView& view, int source, int sink, bool symmetric = false) {
+    ResidualNetwork network(view, symmetric);
+    return maxFlow(network, source, sink);
+    /* complejidad: la de maxFlow mas o(n + m) de la red */
+}
+
+/* flujo maximo entre los vertices con los datos indicados: los pesos de las aristas son las capacidades
+en un grafo dirigido cada arista lleva flujo solo en su sentido */
+template <typename T, typename W>
+MaxFlowResult maxFlow(Graph<T, W>& graph, const T& source, const T& sink) {
+    const CsrView& view = graph.freeze();
+    return maxFlow(view, graph.getIndexByData(source), graph.getIndexByData(sink), false);
+    /* complejidad: la de maxFlow mas la construccion de la instantanea si el grafo cambio */
+}
+
+/* flujo maximo en un grafo no dirigido: cada arista lleva flujo en cualquiera de los dos sentidos hasta su
+capacidad y ocupa un solo par de arcos */
+template <typename T, typename W>
+MaxFlowResult maxFlow(NonDirectedGraph<T, W>& graph, const T& source, const T& sink) {
+    const CsrView& view = graph.freeze();
+    return maxFlow(view, graph.getIndexByData(source), graph.getIndexByData(sink), true);
+    /* complejidad: la de maxFlow mas la construccion de la instantanea si el grafo cambio */
+}
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef MULTISOURCEBFS_H
+#define MULTISOURCEBFS_H
+
+#include <cstddef>
+#include <vector>
+#include "../CsrView.hpp"
+#include "../NonDirectedGraph.hpp"
+#include "Bitset.hpp"
+
+/* resultado de un recorrido en anchura desde varios origenes, indexado por origen y por indice interno */
+struct MultiSourceBfsResult {
+    std::vector<int> sources; /* indices de los origenes, en el orden recibido */
+    std::vector<int> distance; /* distance[k * slots + v]: nivel de v desde el origen k, -1 si no se alcanzo (vacio si no se pidio) */
+    std::vector<int> reached; /* vertices alcanzados desde cada origen (incluye el origen) */
+    std::vector<long> distanceSum; /* suma de las distancias desde cada origen a los vertices alcanzados */
+    std::vector<double> closeness; /* cercania de cada origen: (alcanzados - 1) / distanceSum, 0 si no alcanza a nadie */
+    int slots; /* indices de la instantanea */
+    int batches; /* lotes recorridos (cada lote comparte un solo recorrido de la adyacencia) */
+
+    MultiSourceBfsResult() : slots(0), batches(0) {}
+
+    /* nivel del vertice v desde el k-esimo origen; requiere haber pedido las distancias */
+    int getDistance(int k, int v) const { return distance[static_cast<std::size_t>(k) * slots + v]; }
+};
+
+/* maximo de origenes por lote: 512 bits, ocho palabras de 64 bits por vertice */
+const int msBfsMaxBatch = 512;
+
+/* recorrido en anchura de varios origenes a la vez con paralelismo de bits (ms-bfs, then et al.)
+cada vertice guarda, por cada estado (visto, frontera actual, frontera siguiente), una fila de bits con un bit
+por origen del lote; expandir un vertice de la frontera propaga con un or todos los origenes que lo alcanzaron
+en ese nivel, asi que cada fila de adyacencia se lee una vez por nivel para todo el lote en lugar de una vez
+por origen. los origenes se procesan en lotes de hasta batchSize (como maximo msBfsMaxBatch); un origen fuera
+de la instantanea no alcanza ningun vertice. con storeDistances false solo se calculan los agregados
+(alcanzados, suma de distancias y cercania), sin la matriz de distancias de o(origenes * n) */
+inline MultiSourceBfsResult multiSourceBfs(const CsrView& view, const std::vector<int>& sources,
+                                           bool storeDistances = true, int batchSize = msBfsMaxBatch) {
+    MultiSourceBfsResult result;
+    int slots = view.getVertexSlots();
+    int count = static_cast<int>(sources.size());
+    result.slots = slots;
+    result.sources = sources;
+    result.reached.assign(count, 0);
+    result.distanceSum.assign(count, 0);
+    result.closeness.assign(count, 0.0);
+    if (storeDistances) result.distance.assign(static_cast<std::size_t>(count) * slots, -1);
+    if (batchSize < 1 || batchSize > msBfsMaxBatch) batchSize = msBfsMaxBatch;
+
+    const int bits = Bitset::bitsPerWord();
+    std::vector<unsigned long> seen;
+    std::vector<unsigned long> visit;
+    std::vector<unsigned long> visitNext;
+    std::vector<int> frontier; /* vertices con algun bit en visit */
+    std::vector<int> next; /* vertices con algun bit en visitNext */
+
+    for (int first = 0; first < count; first += batchSize) {
+        int batch = count - first < batchSize ? count - first : batchSize;
+        int words = (batch + bits - 1) / bits; /* palabras por vertice */
+        seen.assign(static_cast<std::size_t>(slots) * words, 0UL);
+        visit.assign(static_cast<std::size_t>(slots) * words, 0UL);
+        visitNext.assign(static_cast<std::size_t>(slots) * words, 0UL);
+        frontier.clear();
+        result.batches++;
+
+        /* siembra los origenes en el nivel 0 (un origen repetido comparte el vertice pero conserva su bit) */
+        for (int k = 0; k < batch; k++) {
+            int s = sources[first + k];
+            if (!view.containsIndex(s)) continue;
+            std::size_t row = static_cast<std::size_t>(s) * words;
+            bool fresh = true;
+            for (int w = 0; w < words; w++) fresh = fresh && visit[row + w] == 0;
+            if (fresh) frontier.push_back(s);
+            seen[row + k / bits] |= 1UL << (k % bits);
+            visit[row + k / bits] |= 1UL << (k % bits);
+            result.reached[first + k] = 1;
+            if (storeDistances) result.distance[static_cast<std::size_t>(first + k) * slots + s] = 0;
+        }
+
+        for (int level = 1; !frontier.empty(); level++) {
+            next.clear();
+            /* expande la frontera: cada vecino recibe los origenes que todavia no lo habian visto */
+            for (std::size_t i = 0; i < frontier.size(); i++) {
+                int u = frontier[i];
+                const unsigned long* from = &visit[static_cast<std::size_t>(u) * words];
+                int end = view.edgeEnd(u);
+                for (int e = view.edgeBegin(u); e < end; e++) {
+                    std::size_t row = static_cast<std::size_t>(view.target(e)) * words;
+                    bool wasEmpty = true;
+                    bool added = false;
+                    for (int w = 0; w < words; w++) {
+                        unsigned long fresh = from[w] & ~seen[row + w];
+                        wasEmpty = wasEmpty && visitNext[row + w] == 0;
+                        if (fresh != 0) {
+                            visitNext[row + w] |= fresh;
+                            added = true;
+                        }
+                    }
+                    if (added && wasEmpty) next.push_back(view.target(e));
+                }
+            }
+            /* marca como vistos los descubrimientos del nivel y registra sus distancias */
+            for (std::size_t i = 0; i < frontier.size(); i++) {
+                std::size_t row = static_cast<std::size_t>(frontier[i]) * words;
+                for (int w = 0; w < words; w++) visit[row + w] = 0;
+            }
+            for (std::size_t i = 0; i < next.size(); i++) {
+                int v = next[i];
+                std::size_t row = static_cast<std::size_t>(v) * words;
+                for (int w = 0; w < words; w++) {
+                    unsigned long fresh = visitNext[row + w];
+                    if (fresh == 0) continue;
+                    seen[row + w] |= fresh;
+                    visit[row + w] = fresh;
+                    visitNext[row + w] = 0;
+                    while (fresh != 0) {
+                        int k = first + w * bits + lowestBit(fresh);
+                        fresh &= fresh - 1;
+                        result.reached[k]++;
+                        result.distanceSum[k] += level;
+                        if (storeDistances) result.distance[static_cast<std::size_t>(k) * slots + v] = level;
+                    }
+                }
+            }
+            frontier.swap(next);
+        }
+    }
+
+    for (int k = 0; k < count; k++) {
+        if (result.distanceSum[k] > 0) result.closeness[k] = (result.reached[k] - 1.0) / result.distanceSum[k];
+    }
+    return result;
+    /* complejidad: o(lotes * (niveles * (n + m) * palabras) + origenes * n) en el peor caso; cada arista se
+    recorre una vez por nivel en que su origen esta en la frontera de algun origen del lote */
+}
+
+/* recorrido en anchura desde varios vertices de un grafo no dirigido, dados sus datos
+los origenes que no existen no alcanzan ningun vertice */
+template <typename T, typename W>
+MultiSourceBfsResult multiSourceBfs(NonDirectedGraph<T, W>& graph, const std::vector<T>& sources,
+                                    bool storeDistances = true, int batchSize = msBfsMaxBatch) {
+    const CsrView& view = graph.freeze();
+    std::vector<int> indices(sources.size());
+    for (std::size_t i = 0; i < sources.size(); i++) indices[i] = graph.getIndexByData(sources[i]);
+    return multiSourceBfs(view, indices, storeDistances, batchSize);
+    /* complejidad: la de la version sobre la instantanea mas su construccion si el grafo cambio */
+}
+
+#endif
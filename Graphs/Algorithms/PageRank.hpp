@@ -0,0 +1,152 @@
+#ifndef PAGERANK_H
+#define PAGERANK_H
+
+#include <cstddef>
+#include <vector>
+#include <ctime> /* para clock */
+#include "../CsrView.hpp"
+#include "../NonDirectedGraph.hpp"
+#include "../DirectedGraph.hpp"
+#include "LiveIndices.hpp"
+
+/* producto matriz dispersa por vector sobre el espacio de indices de una instantanea: y = A x
+con A[v][u] = peso de la entrada v -> u (1.0 si weighted es false). cada fila se acumula en un registro
+y se escribe una sola vez, recorriendo neighbors y weights en orden, asi que la lectura es secuencial
+salvo los accesos a x. x debe tener getVertexSlots() elementos; y se redimensiona */
+inline void sparseMultiply(const CsrView& view, const std::vector<double>& x, std::vector<double>& y,
+                           bool weighted = true) {
+    int slots = view.getVertexSlots();
+    y.resize(slots);
+    if (slots == 0) return;
+    const int* offsets = &view.getOffsets()[0];
+    const int* neighbors = view.getEntryCount() > 0 ? &view.getNeighbors()[0] : NULL;
+    const double* weights = view.getEntryCount() > 0 ? &view.getWeights()[0] : NULL;
+    const double* input = &x[0];
+    for (int v = 0; v < slots; v++) {
+        double sum = 0.0;
+        int end = offsets[v + 1];
+        if (weighted) {
+            for (int e = offsets[v]; e < end; e++) sum += weights[e] * input[neighbors[e]];
+        } else {
+            for (int e = offsets[v]; e < end; e++) sum += input[neighbors[e]];
+        }
+        y[v] = sum;
+    }
+    /* complejidad: o(n + m) */
+}
+
+/* parametros de pagerank */
+struct PageRankOptions {
+    double damping; /* probabilidad de seguir una arista en lugar de saltar a un vertice al azar */
+    double tolerance; /* se detiene cuando la suma de los cambios absolutos de una iteracion es menor */
+    int maxIterations; /* limite de iteraciones */
+    bool weighted; /* reparte el rango de cada vertice en proporcion al peso de sus aristas */
+
+    PageRankOptions() : damping(0.85), tolerance(1e-9), maxIterations(100), weighted(true) {}
+};
+
+/* resultado de pagerank, indexado por los indices internos del grafo */
+struct PageRankResult {
+    std::vector<double> rank; /* rango de cada indice (suma 1 sobre los vertices), 0 para los indices sin vertice */
+    std::vector<double> iterationSeconds; /* tiempo de procesador de cada iteracion, para seguir regresiones */
+    int iterations; /* iteraciones realizadas */
+    double residual; /* suma de los cambios absolutos de la ultima iteracion */
+    bool converged; /* indica si residual quedo por debajo de la tolerancia */
+    double seconds; /* tiempo de procesador total, incluida la preparacion */
+
+    PageRankResult() : iterations(0), residual(0), converged(false), seconds(0) {}
+
+    /* tiempo medio por iteracion en milisegundos */
+    double millisecondsPerIteration() const {
+        double total = 0.0;
+        for (std::size_t i = 0; i < iterationSeconds.size(); i++) total += iterationSeconds[i];
+        return iterationSeconds.empty() ? 0.0 : total * 1000.0 / iterationSeconds.size();
+    }
+};
+
+/* pagerank por iteracion de potencias con sparseMultiply
+outgoing tiene las aristas salientes de cada vertice e incoming las entrantes (la misma instantanea en un
+grafo no dirigido); cada iteracion calcula la contribucion rango/pesoSaliente de cada vertice, la reune
+por las filas de incoming y suma la parte uniforme del salto aleatorio y de la masa de los vertices sin
+aristas salientes, que se reparte entre todos. los vertices sin salida se guardan en un arreglo contiguo
+aparte, asi que su masa se suma en un ciclo sin saltos en lugar de revisar todos los indices.
+isLive decide que indices de la instantanea corresponden a vertices
+NOTA: los pesos deben ser no negativos */
+template <typename LivePredicate>
+PageRankResult pageRank(const CsrView& outgoing, const CsrView& incoming, LivePredicate isLive,
+                        const PageRankOptions& options = PageRankOptions()) {
+    std::clock_t start = std::clock();
+    PageRankResult result;
+    int slots = outgoing.getVertexSlots();
+    result.rank.assign(slots, 0.0);
+
+    /* inverso del peso saliente de cada vertice y lista de vertices sin salida */
+    std::vector<int> live;
+    std::vector<int> dangling;
+    std::vector<double> inverseOut(slots, 0.0);
+    for (int u = 0; u < slots; u++) {
+        if (!isLive(u)) continue;
+        live.push_back(u);
+        double total = 0.0;
+        int end = outgoing.edgeEnd(u);
+        for (int e = outgoing.edgeBegin(u); e < end; e++) total += options.weighted ? outgoing.weight(e) : 1.0;
+        if (total > 0.0) {
+            inverseOut[u] = 1.0 / total;
+        } else {
+            dangling.push_back(u);
+        }
+    }
+    int n = static_cast<int>(live.size());
+    if (n == 0) return result;
+
+    for (int i = 0; i < n; i++) result.rank[live[i]] = 1.0 / n;
+    std::vector<double> contribution(slots, 0.0);
+    std::vector<double> gathered;
+    while (result.iterations < options.maxIterations) {
+        std::clock_t iterationStart = std::clock();
+        for (int u = 0; u < slots; u++) contribution[u] = result.rank[u] * inverseOut[u];
+        double danglingMass = 0.0;
+        for (std::size_t i = 0; i < dangling.size(); i++) danglingMass += result.rank[dangling[i]];
+
+        sparseMultiply(incoming, contribution, gathered, options.weighted);
+
+        double base = ((1.0 - options.damping) + options.damping * danglingMass) / n;
+        double residual = 0.0;
+        for (int i = 0; i < n; i++) {
+            int v = live[i];
+            double next = base + options.damping * gathered[v];
+            residual += next > result.rank[v] ? next - result.rank[v] : result.rank[v] - next;
+            result.rank[v] = next;
+        }
+        result.iterations++;
+        result.residual = residual;
+        result.iterationSeconds.push_back(static_cast<double>(std::clock() - iterationStart) / CLOCKS_PER_SEC);
+        if (residual < options.tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+    result.seconds = static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+    return result;
+    /* complejidad: o(n + m) por iteracion */
+}
+
+/* pagerank de un grafo no dirigido: cada arista reparte rango en ambos sentidos */
+template <typename T, typename W>
+PageRankResult pageRank(NonDirectedGraph<T, W>& graph, const PageRankOptions& options = PageRankOptions()) {
+    const CsrView& view = graph.freeze();
+    return pageRank(view, view, GraphIndexLive<T, W>(graph), options);
+    /* complejidad: o(n + m) por iteracion mas la construccion de la instantanea si el grafo cambio */
+}
+
+/* pagerank de un grafo dirigido: las aristas entrantes salen de la instantanea transpuesta */
+template <typename T, typename W>
+PageRankResult pageRank(DirectedGraph<T, W>& graph, const PageRankOptions& options = PageRankOptions()) {
+    const CsrView& view = graph.freeze();
+    CsrView reverse;
+    view.transposeInto(reverse);
+    return pageRank(view, reverse, GraphIndexLive<T, W>(graph), options);
+    /* complejidad: o(n + m) por iteracion mas o(n + m) de la transpuesta */
+}
+
+#endif
@@ -0,0 +1,262 @@
+#ifndef SHORTESTPATHS_H
+#define SHORTESTPATHS_H
+
+#include <cstddef>
+#include <vector>
+#include <algorithm> /* para reverse */
+#include <limits> /* para numeric_limits */
+#include "../CsrView.hpp"
+#include "../Graph.hpp"
+#include "IndexedHeap.hpp"
+
+/* resultado de un calculo de caminos minimos desde un origen, indexado por los indices internos del grafo */
+struct ShortestPathResult {
+    std::vector<double> distance; /* distancia minima desde el origen, -1.0 si el vertice no se alcanzo */
+    std::vector<int> predecessor; /* vertice anterior en el camino minimo, -1 para el origen y los no alcanzados */
+    int settled; /* numero de vertices con distancia definitiva */
+
+    ShortestPathResult() : settled(0) {}
+};
+
+/* dijkstra desde un origen sobre una instantanea csr con un monticulo d-ario indexado
+NOTA: los pesos deben ser no negativos */
+inline ShortestPathResult dijkstra(const CsrView& view, int source) {
+    ShortestPathResult result;
+    int slots = view.getVertexSlots();
+    result.distance.assign(slots, -1.0);
+    result.predecessor.assign(slots, -1);
+    if (!view.containsIndex(source)) return result;
+
+    IndexedHeap<double> heap(slots);
+    std::vector<bool> done(slots, false);
+    result.distance[source] = 0.0;
+    heap.push(source, 0.0);
+    while (!heap.empty()) {
+        double base = heap.topKey();
+        int u = heap.pop();
+        done[u] = true;
+        result.settled++;
+        int end = view.edgeEnd(u);
+        for (int e = view.edgeBegin(u); e < end; e++) {
+            int v = view.target(e);
+            if (done[v]) continue;
+            double candidate = base + view.weight(e);
+            if (heap.pushOrDecrease(v, candidate)) {
+                result.distance[v] = candidate;
+                result.predecessor[v] = u;
+            }
+        }
+    }
+    return result;
+    /* complejidad: o((n + m) log_d n) */
+}
+
+/* dijkstra desde el vertice con el dato indicado, sobre la instantanea csr del grafo (dirigido o no) */
+template <typename T, typename W>
+ShortestPathResult dijkstra(Graph<T, W>& graph, const T& source) {
+    const CsrView& view = graph.freeze();
+    return dijkstra(view, graph.getIndexByData(source));
+    /* complejidad: o((n + m) log_d n) mas la construccion de la instantanea si el grafo cambio */
+}
+
+/* heuristica nula: convierte a* en dijkstra de punto a punto */
+struct ZeroHeuristic {
+    double operator()(int, int) const { return 0.0; }
+};
+
+/* consultas de camino minimo de punto a punto que reutilizan su memoria entre consultas
+los arreglos de distancias y predecesores se reservan una vez por instantanea y cada consulta solo limpia
+los vertices que toco, asi que el costo de una consulta depende de la region explorada y no del tamaño del grafo
+NOTA: los pesos deben ser no negativos; las instantaneas deben seguir vivas mientras se use el objeto */
+class ShortestPathQuery {
+private:
+    const CsrView* forward; /* aristas salientes */
+    const CsrView* backward; /* aristas entrantes (la misma instantanea si el grafo no es dirigido) */
+    std::vector<double> distance; /* distancia desde el origen */
+    std::vector<double> backDistance; /* distancia hasta el destino (busqueda bidireccional) */
+    std::vector<int> predecessor; /* vertice anterior hacia el origen */
+    std::vector<int> successor; /* vertice siguiente hacia el destino (busqueda bidireccional) */
+    std::vector<int> touched; /* vertices modificados por la ultima consulta */
+    IndexedHeap<double> heap; /* frontera hacia adelante */
+    IndexedHeap<double> backHeap; /* frontera hacia atras */
+    int source; /* origen de la ultima consulta */
+    int target; /* destino de la ultima consulta */
+    int settled; /* vertices extraidos de los monticulos en la ultima consulta */
+
+    static double infinity() { return std::numeric_limits<double>::infinity(); }
+
+    /* restaura los arreglos de la consulta anterior */
+    void reset(int newSource, int newTarget) {
+        for (std::size_t i = 0; i < touched.size(); i++) {
+            distance[touched[i]] = backDistance[touched[i]] = infinity();
+            predecessor[touched[i]] = successor[touched[i]] = -1;
+        }
+        touched.clear();
+        heap.clear();
+        backHeap.clear();
+        source = newSource;
+        target = newTarget;
+        settled = 0;
+        /* complejidad: o(vertices tocados por la consulta anterior) */
+    }
+
+    bool validQuery(int from, int to) const {
+        return forward->containsIndex(from) && forward->containsIndex(to);
+    }
+
+public:
+    /* consultas sobre un grafo no dirigido: ambas direcciones usan la misma instantanea */
+    explicit ShortestPathQuery(const CsrView& view) : source(-1), target(-1), settled(0) {
+        bind(view, view);
+    }
+
+    /* consultas sobre un grafo dirigido: reverse debe ser la transpuesta de view (CsrView::transposeInto) */
+    ShortestPathQuery(const CsrView& view, const CsrView& reverse) : source(-1), target(-1), settled(0) {
+        bind(view, reverse);
+    }
+
+    /* asocia el objeto a otras instantaneas y reserva los arreglos a su tamaño */
+    void bind(const CsrView& view, const CsrView& reverse) {
+        forward = &view;
+        backward = &reverse;
+        int slots = view.getVertexSlots();
+        distance.assign(slots, infinity());
+        backDistance.assign(slots, infinity());
+        predecessor.assign(slots, -1);
+        successor.assign(slots, -1);
+        touched.clear();
+        heap.assign(slots);
+        backHeap.assign(slots);
+        source = target = -1;
+        settled = 0;
+        /* complejidad: o(n) */
+    }
+
+    /* a* de punto a punto: heuristic(v, to) debe ser una cota inferior de la distancia de v a to
+    con una heuristica consistente cada vertice se extrae una sola vez; con una solo admisible se reabren
+    vertices cuando se mejora su distancia. retorna la distancia, o -1.0 si no hay camino */
+    template <typename Heuristic>
+    double aStar(int from, int to, Heuristic heuristic) {
+        reset(from, to);
+        if (!validQuery(from, to)) return -1.0;
+        distance[from] = 0.0;
+        touched.push_back(from);
+        heap.push(from, heuristic(from, to));
+        while (!heap.empty()) {
+            int u = heap.pop();
+            settled++;
+            if (u == to) return distance[to];
+            double base = distance[u];
+            int end = forward->edgeEnd(u);
+            for (int e = forward->edgeBegin(u); e < end; e++) {
+                int v = forward->target(e);
+                double candidate = base + forward->weight(e);
+                if (candidate < distance[v]) {
+                    if (distance[v] == infinity()) touched.push_back(v);
+                    distance[v] = candidate;
+                    predecessor[v] = u;
+                    double estimate = candidate + heuristic(v, to);
+                    if (heap.contains(v)) {
+                        heap.decreaseKey(v, estimate);
+                    } else {
+                        heap.push(v, estimate);
+                    }
+                }
+            }
+        }
+        return -1.0;
+        /* complejidad: o((n + m) log_d n) en el peor caso; la heuristica reduce la region explorada */
+    }
+
+    /* dijkstra de punto a punto: se detiene al extraer el destino */
+    double dijkstra(int from, int to) {
+        return aStar(from, to, ZeroHeuristic());
+        /* complejidad: o((n' + m') log_d n') con n', m' la region mas cercana al origen que el destino */
+    }
+
+    /* dijkstra bidireccional: avanza alternadamente desde el origen y desde el destino, siempre por la frontera
+    de menor clave, y termina cuando la suma de ambas claves minimas no puede mejorar el mejor camino visto
+    retorna la distancia, o -1.0 si no hay camino */
+    double bidirectional(int from, int to) {
+        reset(from, to);
+        if (!validQuery(from, to)) return -1.0;
+        distance[from] = 0.0;
+        backDistance[to] = 0.0;
+        touched.push_back(from);
+        touched.push_back(to);
+        heap.push(from, 0.0);
+        backHeap.push(to, 0.0);
+        double best = from == to ? 0.0 : infinity();
+        int meeting = from == to ? from : -1;
+
+        while (!heap.empty() && !backHeap.empty()) {
+            if (heap.topKey() + backHeap.topKey() >= best) break;
+            bool forwardStep = heap.topKey() <= backHeap.topKey();
+            IndexedHeap<double>& side = forwardStep ? heap : backHeap;
+            const CsrView& view = forwardStep ? *forward : *backward;
+            std::vector<double>& mine = forwardStep ? distance : backDistance;
+            std::vector<double>& other = forwardStep ? backDistance : distance;
+            std::vector<int>& link = forwardStep ? predecessor : successor;
+
+            double base = side.topKey();
+            int u = side.pop();
+            settled++;
+            int end = view.edgeEnd(u);
+            for (int e = view.edgeBegin(u); e < end; e++) {
+                int v = view.target(e);
+                double candidate = base + view.weight(e);
+                if (candidate < mine[v]) {
+                    if (distance[v] == infinity() && backDistance[v] == infinity()) touched.push_back(v);
+                    mine[v] = candidate;
+                    link[v] = u;
+                    side.pushOrDecrease(v, candidate);
+                }
+                /* el vertice ya fue alcanzado desde el otro lado: posible camino completo */
+                if (other[v] != infinity() && mine[v] + other[v] < best) {
+                    best = mine[v] + other[v];
+                    meeting = v;
+                }
+            }
+        }
+        if (meeting < 0) return -1.0;
+
+        /* copia el tramo meeting -> destino en los predecesores para que getPath funcione igual que en a* */
+        for (int v = meeting; v != to; v = successor[v]) {
+            int next = successor[v];
+            if (distance[next] == infinity() && backDistance[next] == infinity()) touched.push_back(next);
+            predecessor[next] = v;
+            distance[next] = best - backDistance[next];
+        }
+        return best;
+        /* complejidad: o((n + m) log_d n) en el peor caso, tipicamente explora mucho menos que dijkstra */
+    }
+
+    /* distancia desde el origen de la ultima consulta (-1.0 si el vertice no fue alcanzado) */
+    double getDistance(int vertex) const {
+        return distance[vertex] == infinity() ? -1.0 : distance[vertex];
+    }
+
+    /* predecesor de un vertice en el camino encontrado por la ultima consulta (-1 si no tiene) */
+    int getPredecessor(int vertex) const { return predecessor[vertex]; }
+
+    /* numero de vertices extraidos de los monticulos en la ultima consulta */
+    int getSettledCount() const { return settled; }
+
+    /* escribe en path los indices del camino origen -> destino de la ultima consulta; retorna false si no hay camino */
+    bool getPath(std::vector<int>& path) const {
+        path.clear();
+        if (target < 0 || !forward->containsIndex(target) || distance[target] == infinity()) return false;
+        /* sigue los predecesores desde el destino y luego invierte el recorrido */
+        int v = target;
+        path.push_back(v);
+        while (v != source) {
+            v = predecessor[v];
+            path.push_back(v);
+        }
+        std::reverse(path.begin(), path.end());
+        return true;
+        /* complejidad: o(longitud del camino) */
+    }
+};
+
+#endif
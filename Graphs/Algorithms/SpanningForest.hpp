@@ -0,0 +1,220 @@
+#ifndef SPANNINGFOREST_H
+#define SPANNINGFOREST_H
+
+#include <cstddef>
+#include <vector>
+#include <algorithm> /* para sort */
+#include <utility> /* para pair */
+#include "../CsrView.hpp"
+#include "../NonDirectedGraph.hpp"
+#include "UnionFind.hpp"
+#include "LiveIndices.hpp"
+
+/* algoritmo para calcular el bosque generador minimo */
+enum SpanningForestAlgorithm {
+    SPANNING_AUTO = 0, /* kruskal hasta spanningKruskalMaxDegree de grado promedio, boruvka por encima */
+    SPANNING_BORUVKA = 1, /* rondas en que cada componente elige su arista mas liviana */
+    SPANNING_KRUSKAL = 2 /* aristas ordenadas por peso y conjuntos disjuntos */
+};
+
+/* grado promedio hasta el que SPANNING_AUTO usa kruskal; lo que decide es la densidad y no el tamaño
+medido con las banderas del Makefile (sin optimizar), m aristas aleatorias sobre n vertices, mejor de tres:
+  m = n:   1e3 aristas boruvka 0.35 ms, kruskal 0.35 ms; 2.6e5 aristas boruvka 196 ms, kruskal 186 ms
+  m = 2n:  2e3 aristas boruvka 0.59 ms, kruskal 0.69 ms; 5.2e5 aristas boruvka 314 ms, kruskal 386 ms
+  m = 6n:  9e2 aristas boruvka 0.21 ms, kruskal 0.29 ms; 3.1e6 aristas boruvka 2183 ms, kruskal 2582 ms
+  m = 32n: 6e2 aristas boruvka 0.11 ms, kruskal 0.15 ms; 8.4e6 aristas boruvka 3817 ms, kruskal 4943 ms
+con -O2 la proporcion se mantiene (3.1e6 aristas con m = 6n: boruvka 575 ms, kruskal 777 ms)
+kruskal solo empata en grafos muy ralos, donde ordenar pocas aristas por vertice es tan barato como las rondas */
+const int spanningKruskalMaxDegree = 2;
+
+/* arista del bosque, entre indices internos */
+struct SpanningEdge {
+    int source;
+    int destination;
+    double weight;
+
+    SpanningEdge() : source(-1), destination(-1), weight(0) {}
+    SpanningEdge(int newSource, int newDestination, double newWeight)
+        : source(newSource), destination(newDestination), weight(newWeight) {}
+};
+
+/* bosque generador minimo: un arbol por componente conexa */
+struct SpanningForestResult {
+    std::vector<SpanningEdge> edges; /* aristas del bosque, con source < destination */
+    double totalWeight; /* suma de los pesos de las aristas del bosque */
+    int trees; /* arboles del bosque (componentes conexas, incluidos los vertices aislados) */
+    int rounds; /* rondas de boruvka (0 con kruskal) */
+    SpanningForestAlgorithm algorithm; /* algoritmo usado */
+
+    SpanningForestResult() : totalWeight(0), trees(0), rounds(0), algorithm(SPANNING_AUTO) {}
+};
+
+/* metodo auxiliar: aristas source < destination de la instantanea (sin lazos) en arreglos paralelos
+la posicion de cada arista en la lista es su identificador, que desempata los pesos iguales */
+template <typename LivePredicate>
+int spanningEdgeList(const CsrView& view, LivePredicate isLive, std::vector<int>& from, std::vector<int>& to,
+                     std::vector<double>& weights) {
+    int slots = view.getVertexSlots();
+    int live = 0;
+    from.clear();
+    to.clear();
+    weights.clear();
+    from.reserve(view.getEntryCount() / 2);
+    to.reserve(view.getEntryCount() / 2);
+    weights.reserve(view.getEntryCount() / 2);
+    for (int u = 0; u < slots; u++) {
+        if (!isLive(u)) continue;
+        live++;
+        for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+            int v = view.target(e);
+            if (v <= u) continue;
+            from.push_back(u);
+            to.push_back(v);
+            weights.push_back(view.weight(e));
+        }
+    }
+    return live;
+    /* complejidad: o(n + m) */
+}
+
+/* boruvka: en cada ronda cada componente elige su arista saliente mas liviana (a igual peso, la de menor
+identificador, lo que da un orden total y evita ciclos) y todas las elegidas se agregan a la vez.
+cada ronda al menos divide a la mitad las componentes, asi que hay a lo sumo log2(n) rondas. entre rondas los
+extremos de cada arista se reemplazan por la raiz de su componente y se descartan las aristas internas, de
+modo que las rondas siguientes recorren solo las aristas que todavia cruzan componentes, en arreglos
+contiguos (extremos, peso e identificador) que se leen en orden */
+template <typename LivePredicate>
+SpanningForestResult boruvkaForest(const CsrView& view, LivePredicate isLive) {
+    SpanningForestResult result;
+    result.algorithm = SPANNING_BORUVKA;
+    int slots = view.getVertexSlots();
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<double> weights;
+    int live = spanningEdgeList(view, isLive, from, to, weights);
+    int count = static_cast<int>(from.size());
+    /* aristas que todavia cruzan componentes: extremos (raices), peso e identificador original */
+    std::vector<int> left(from);
+    std::vector<int> right(to);
+    std::vector<double> crossing(weights);
+    std::vector<int> id(count);
+    for (int i = 0; i < count; i++) id[i] = i;
+
+    UnionFind sets(slots);
+    std::vector<int> label(slots); /* raiz de la componente de cada indice al terminar la ronda */
+    std::vector<int> bestEdge(slots, -1); /* identificador de la arista elegida por cada raiz */
+    std::vector<double> bestWeight(slots, 0.0);
+    while (count > 0) {
+        result.rounds++;
+        for (int i = 0; i < count; i++) {
+            double w = crossing[i];
+            int edge = id[i];
+            int a = left[i];
+            int b = right[i];
+            if (bestEdge[a] < 0 || w < bestWeight[a] || (w == bestWeight[a] && edge < bestEdge[a])) {
+                bestEdge[a] = edge;
+                bestWeight[a] = w;
+            }
+            if (bestEdge[b] < 0 || w < bestWeight[b] || (w == bestWeight[b] && edge < bestEdge[b])) {
+                bestEdge[b] = edge;
+                bestWeight[b] = w;
+            }
+        }
+        /* una arista elegida por sus dos componentes se agrega una sola vez: la segunda unite falla */
+        bool added = false;
+        for (int i = 0; i < count; i++) {
+            int a = left[i];
+            int b = right[i];
+            if (bestEdge[a] < 0 && bestEdge[b] < 0) continue;
+            int ends[2] = { a, b };
+            for (int k = 0; k < 2; k++) {
+                int edge = bestEdge[ends[k]];
+                if (edge < 0) continue;
+                bestEdge[ends[k]] = -1;
+                if (sets.unite(from[edge], to[edge])) {
+                    result.edges.push_back(SpanningEdge(from[edge], to[edge], weights[edge]));
+                    result.totalWeight += weights[edge];
+                    added = true;
+                }
+            }
+        }
+        if (!added) break;
+        /* contraccion: extremos a raices y fuera las aristas internas */
+        for (int v = 0; v < slots; v++) label[v] = sets.find(v);
+        int kept = 0;
+        for (int i = 0; i < count; i++) {
+            int a = label[left[i]];
+            int b = label[right[i]];
+            if (a == b) continue;
+            left[kept] = a;
+            right[kept] = b;
+            crossing[kept] = crossing[i];
+            id[kept] = id[i];
+            kept++;
+        }
+        count = kept;
+    }
+    result.trees = live - static_cast<int>(result.edges.size());
+    return result;
+    /* complejidad: o(m log n) en el peor caso, con memoria o(n + m) */
+}
+
+/* kruskal: recorre las aristas por peso creciente (con el mismo desempate que boruvka, asi que ambos
+producen el mismo bosque) y agrega las que unen dos componentes distintas. se ordenan pares (peso,
+identificador) contiguos, que se comparan sin indirecciones, y los conjuntos disjuntos (union por tamaño y
+compresion a la mitad) viven en dos arreglos de enteros; para en cuanto el bosque queda completo */
+template <typename LivePredicate>
+SpanningForestResult kruskalForest(const CsrView& view, LivePredicate isLive) {
+    SpanningForestResult result;
+    result.algorithm = SPANNING_KRUSKAL;
+    int slots = view.getVertexSlots();
+    std::vector<int> from;
+    std::vector<int> to;
+    std::vector<double> weights;
+    int live = spanningEdgeList(view, isLive, from, to, weights);
+    int count = static_cast<int>(from.size());
+    std::vector<std::pair<double, int> > order(count);
+    for (int i = 0; i < count; i++) order[i] = std::make_pair(weights[i], i);
+    std::sort(order.begin(), order.end());
+
+    UnionFind sets(slots);
+    int needed = live - 1; /* aristas de un arbol generador si el grafo fuera conexo */
+    for (int i = 0; i < count && static_cast<int>(result.edges.size()) < needed; i++) {
+        int edge = order[i].second;
+        if (sets.unite(from[edge], to[edge])) {
+            result.edges.push_back(SpanningEdge(from[edge], to[edge], weights[edge]));
+            result.totalWeight += weights[edge];
+        }
+    }
+    result.trees = live - static_cast<int>(result.edges.size());
+    return result;
+    /* complejidad: o(m log m) */
+}
+
+/* bosque generador minimo de una instantanea simetrica (grafo no dirigido) con el algoritmo indicado
+isLive decide que indices de la instantanea corresponden a vertices */
+template <typename LivePredicate>
+SpanningForestResult minimumSpanningForest(const CsrView& view, LivePredicate isLive,
+                                           SpanningForestAlgorithm algorithm = SPANNING_AUTO) {
+    if (algorithm == SPANNING_AUTO) {
+        /* cada arista ocupa dos entradas, asi que entradas / casillas es el grado promedio */
+        algorithm = view.getEntryCount() <= static_cast<long>(spanningKruskalMaxDegree) * view.getVertexSlots()
+            ? SPANNING_KRUSKAL : SPANNING_BORUVKA;
+    }
+    if (algorithm == SPANNING_KRUSKAL) return kruskalForest(view, isLive);
+    return boruvkaForest(view, isLive);
+}
+
+inline SpanningForestResult minimumSpanningForest(const CsrView& view, SpanningForestAlgorithm algorithm = SPANNING_AUTO) {
+    return minimumSpanningForest(view, AllIndicesLive(), algorithm);
+}
+
+/* bosque generador minimo de un grafo no dirigido a partir de su instantanea csr; las aristas usan indices internos */
+template <typename T, typename W>
+SpanningForestResult minimumSpanningForest(NonDirectedGraph<T, W>& graph, SpanningForestAlgorithm algorithm = SPANNING_AUTO) {
+    const CsrView& view = graph.freeze();
+    return minimumSpanningForest(view, GraphIndexLive<T, W>(graph), algorithm);
+    /* complejidad: o(m log n) mas la construccion de la instantanea si el grafo cambio */
+}
+
+#endif
@@ -0,0 +1,256 @@
+#ifndef TRIANGLECOUNTING_H
+#define TRIANGLECOUNTING_H
+
+#include <cstddef>
+#include <vector>
+#include "../CsrView.hpp"
+#include "../NonDirectedGraph.hpp"
+#include "LiveIndices.hpp"
+
+/* triangulos de un grafo no dirigido, indexados por los indices internos */
+struct TriangleResult {
+    long total; /* triangulos del grafo */
+    std::vector<long> perVertex; /* triangulos que contienen a cada indice */
+    std::vector<double> clustering; /* coeficiente de agrupamiento local: triangulos / (d (d - 1) / 2), 0 si d < 2 */
+    double averageClustering; /* promedio de los coeficientes locales sobre los vertices */
+    double transitivity; /* 3 * triangulos / caminos de longitud dos (coeficiente global) */
+
+    TriangleResult() : total(0), averageClustering(0), transitivity(0) {}
+};
+
+/* desbalance a partir del cual la interseccion busca cada elemento de la lista corta en la larga */
+const int triangleGallopRatio = 32;
+
+/* escribe en common los elementos comunes de dos listas ordenadas sin repetidos y retorna cuantos son
+common debe tener espacio para el tamaño de la lista mas corta.
+con listas de tamaño parecido avanza las dos a la vez sin saltos condicionales: la escritura es incondicional
+y el avance de cada lista y del resultado se calcula con comparaciones, porque en listas aleatorias una rama
+por comparacion falla la mitad de las veces. si una lista es mucho mas larga que la otra, como pasa con los
+vertices de grado alto de los grafos de ley de potencias, busca cada elemento de la corta en la larga con
+busqueda exponencial desde la ultima posicion encontrada */
+inline int intersectSorted(const int* a, int sizeA, const int* b, int sizeB, int* common) {
+    if (sizeA > sizeB) {
+        const int* swapList = a; a = b; b = swapList;
+        int swapSize = sizeA; sizeA = sizeB; sizeB = swapSize;
+    }
+    int found = 0;
+    if (sizeA == 0) return 0;
+    if (sizeB / sizeA >= triangleGallopRatio) {
+        int low = 0;
+        for (int i = 0; i < sizeA && low < sizeB; i++) {
+            int value = a[i];
+            /* avanza en saltos crecientes hasta pasar value y luego busca en binario dentro del ultimo salto */
+            int high = low;
+            int step = 1;
+            while (high < sizeB && b[high] < value) {
+                low = high + 1;
+                high += step;
+                step <<= 1;
+            }
+            if (high > sizeB) high = sizeB;
+            while (low < high) {
+                int middle = low + (high - low) / 2;
+                if (b[middle] < value) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            if (low < sizeB && b[low] == value) common[found++] = value;
+        }
+        return found;
+        /* complejidad: o(sizeA log(sizeB / sizeA)) */
+    }
+    int i = 0;
+    int j = 0;
+    while (i < sizeA && j < sizeB) {
+        int x = a[i];
+        int y = b[j];
+        common[found] = x;
+        found += x == y;
+        i += x <= y;
+        j += y <= x;
+    }
+    return found;
+    /* complejidad: o(sizeA + sizeB) */
+}
+
+/* conteo de triangulos por orientacion de grado: cada arista se orienta hacia el extremo de mayor rango
+(rango = grado y, a igual grado, indice), asi cada vertice conserva a lo sumo o(raiz(m)) vecinos salientes y
+cada triangulo se encuentra una sola vez, al intersectar las listas salientes de sus dos vertices de menor
+rango. las filas de la instantanea estan ordenadas, por lo que las listas filtradas siguen ordenadas.
+isLive decide que indices de la instantanea corresponden a vertices
+NOTA: la adyacencia debe ser simetrica (grafo no dirigido); los lazos no forman triangulos y se ignoran */
+template <typename LivePredicate>
+TriangleResult countTriangles(const CsrView& view, LivePredicate isLive) {
+    TriangleResult result;
+    int slots = view.getVertexSlots();
+    result.perVertex.assign(slots, 0);
+    result.clustering.assign(slots, 0.0);
+
+    /* grado sin lazos de cada indice */
+    std::vector<int> degree(slots, 0);
+    for (int u = 0; u < slots; u++) {
+        for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+            if (view.target(e) != u) degree[u]++;
+        }
+    }
+
+    /* adyacencia orientada hacia los vecinos de mayor rango */
+    std::vector<int> start(slots + 1, 0);
+    std::vector<int> forward;
+    forward.reserve(view.getEntryCount() / 2 + 1);
+    int maxForward = 0;
+    for (int u = 0; u < slots; u++) {
+        for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+            int v = view.target(e);
+            if (degree[v] > degree[u] || (degree[v] == degree[u] && v > u)) forward.push_back(v);
+        }
+        start[u + 1] = static_cast<int>(forward.size());
+        if (start[u + 1] - start[u] > maxForward) maxForward = start[u + 1] - start[u];
+    }
+
+    std::vector<int> common(maxForward + 1);
+    for (int u = 0; u < slots; u++) {
+        int sizeU = start[u + 1] - start[u];
+        if (sizeU < 2) continue;
+        const int* listU = &forward[start[u]];
+        for (int k = 0; k < sizeU; k++) {
+            int v = listU[k];
+            int sizeV = start[v + 1] - start[v];
+            if (sizeV == 0) continue;
+            /* cada w comun cierra el triangulo u, v, w */
+            int found = intersectSorted(listU, sizeU, &forward[start[v]], sizeV, &common[0]);
+            for (int i = 0; i < found; i++) result.perVertex[common[i]]++;
+            result.perVertex[u] += found;
+            result.perVertex[v] += found;
+            result.total += found;
+        }
+    }
+
+    /* coeficientes de agrupamiento */
+    double wedges = 0.0;
+    double clusteringSum = 0.0;
+    int liveCount = 0;
+    for (int u = 0; u < slots; u++) {
+        if (!isLive(u)) continue;
+        liveCount++;
+        double pairs = degree[u] * (degree[u] - 1.0) / 2.0;
+        wedges += pairs;
+        if (pairs > 0) result.clustering[u] = result.perVertex[u] / pairs;
+        clusteringSum += result.clustering[u];
+    }
+    if (liveCount > 0) result.averageClustering = clusteringSum / liveCount;
+    if (wedges > 0) result.transitivity = 3.0 * result.total / wedges;
+    return result;
+    /* complejidad: o(m raiz(m)) en el peor caso, con memoria o(n + m) */
+}
+
+inline TriangleResult countTriangles(const CsrView& view) {
+    return countTriangles(view, AllIndicesLive());
+}
+
+/* triangulos de un grafo no dirigido a partir de su instantanea csr */
+template <typename T, typename W>
+TriangleResult countTriangles(NonDirectedGraph<T, W>& graph) {
+    const CsrView& view = graph.freeze();
+    return countTriangles(view, GraphIndexLive<T, W>(graph));
+    /* complejidad: o(m raiz(m)) mas la construccion de la instantanea si el grafo cambio */
+}
+
+/* descomposicion en k-nucleos, indexada por los indices internos */
+struct CoreResult {
+    std::vector<int> core; /* numero de nucleo de cada indice: mayor k tal que pertenece al k-nucleo, -1 sin vertice */
+    std::vector<int> order; /* indices vivos en el orden en que se eliminaron (orden de degeneracion) */
+    int maxCore; /* degeneracion del grafo: mayor numero de nucleo */
+
+    CoreResult() : maxCore(0) {}
+
+    /* cantidad de vertices del k-nucleo (los de numero de nucleo >= k) */
+    int coreSize(int k) const {
+        int count = 0;
+        for (std::size_t v = 0; v < core.size(); v++) {
+            if (core[v] >= k) count++;
+        }
+        return count;
+    }
+};
+
+/* k-nucleos por eliminacion con cubetas (batagelj-zaversnik): los vertices se ordenan por grado en un solo
+arreglo dividido en cubetas contiguas y se eliminan de menor a mayor grado; al eliminar un vertice, cada
+vecino de grado mayor baja una cubeta intercambiandose con el primero de la suya, en o(1).
+el grado de un vertice al eliminarlo es su numero de nucleo
+NOTA: la adyacencia debe ser simetrica; los lazos se ignoran */
+template <typename LivePredicate>
+CoreResult coreDecomposition(const CsrView& view, LivePredicate isLive) {
+    CoreResult result;
+    int slots = view.getVertexSlots();
+    result.core.assign(slots, -1);
+
+    std::vector<int> degree(slots, 0);
+    int maxDegree = 0;
+    int liveCount = 0;
+    for (int u = 0; u < slots; u++) {
+        if (!isLive(u)) continue;
+        liveCount++;
+        for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+            if (view.target(e) != u) degree[u]++;
+        }
+        if (degree[u] > maxDegree) maxDegree = degree[u];
+    }
+
+    /* bucketStart[d] es la primera posicion de la cubeta de grado d en sorted; position es la inversa de sorted */
+    std::vector<int> bucketStart(maxDegree + 2, 0);
+    for (int u = 0; u < slots; u++) {
+        if (isLive(u)) bucketStart[degree[u] + 1]++;
+    }
+    for (int d = 0; d <= maxDegree; d++) {
+        bucketStart[d + 1] += bucketStart[d];
+    }
+    std::vector<int> sorted(liveCount);
+    std::vector<int> position(slots, -1);
+    std::vector<int> next(bucketStart.begin(), bucketStart.end() - 1);
+    for (int u = 0; u < slots; u++) {
+        if (!isLive(u)) continue;
+        position[u] = next[degree[u]]++;
+        sorted[position[u]] = u;
+    }
+
+    for (int i = 0; i < liveCount; i++) {
+        int u = sorted[i];
+        result.core[u] = degree[u];
+        if (degree[u] > result.maxCore) result.maxCore = degree[u];
+        for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+            int v = view.target(e);
+            if (v == u || degree[v] <= degree[u]) continue;
+            /* v pasa a la cubeta de grado uno menor: se intercambia con el primero de su cubeta y la cubeta se achica */
+            int first = bucketStart[degree[v]];
+            int w = sorted[first];
+            if (w != v) {
+                sorted[position[v]] = w;
+                position[w] = position[v];
+                sorted[first] = v;
+                position[v] = first;
+            }
+            bucketStart[degree[v]]++;
+            degree[v]--;
+        }
+    }
+    result.order.swap(sorted);
+    return result;
+    /* complejidad: o(n + m) */
+}
+
+inline CoreResult coreDecomposition(const CsrView& view) {
+    return coreDecomposition(view, AllIndicesLive());
+}
+
+/* k-nucleos de un grafo no dirigido a partir de su instantanea csr */
+template <typename T, typename W>
+CoreResult coreDecomposition(NonDirectedGraph<T, W>& graph) {
+    const CsrView& view = graph.freeze();
+    return coreDecomposition(view, GraphIndexLive<T, W>(graph));
+    /* complejidad: o(n + m) mas la construccion de la instantanea si el grafo cambio */
+}
+
+#endif
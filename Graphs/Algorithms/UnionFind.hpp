@@ -0,0 +1,72 @@
+#ifndef UNIONFIND_H
+#define UNIONFIND_H
+
+#include <vector>
+
+/* conjuntos disjuntos sobre indices [0, n) con union por tamaño y compresion de caminos por division a la mitad
+las operaciones cuestan o(alfa(n)) amortizado, practicamente constante */
+class UnionFind {
+private:
+    std::vector<int> parent; /* padre de cada elemento; una raiz es su propio padre */
+    std::vector<int> setSize; /* tamaño del conjunto, valido solo en las raices */
+    int sets; /* numero de conjuntos disjuntos */
+
+public:
+    UnionFind() : sets(0) {}
+    explicit UnionFind(int count) : sets(0) {
+        assign(count);
+    }
+
+    /* reinicia la estructura con count conjuntos de un elemento */
+    void assign(int count) {
+        parent.resize(count);
+        setSize.assign(count, 1);
+        for (int i = 0; i < count; i++) {
+            parent[i] = i;
+        }
+        sets = count;
+        /* complejidad: o(n) */
+    }
+
+    int size() const { return static_cast<int>(parent.size()); }
+    int getSetCount() const { return sets; }
+
+    /* raiz del conjunto de un elemento; cada nodo visitado pasa a apuntar a su abuelo */
+    int find(int element) {
+        while (parent[element] != element) {
+            parent[element] = parent[parent[element]];
+            element = parent[element];
+        }
+        return element;
+        /* complejidad: o(alfa(n)) amortizado */
+    }
+
+    /* une los conjuntos de dos elementos, retorna false si ya estaban juntos */
+    bool unite(int first, int second) {
+        first = find(first);
+        second = find(second);
+        if (first == second) return false;
+        /* cuelga el conjunto menor del mayor para mantener los arboles bajos */
+        if (setSize[first] < setSize[second]) {
+            int swap = first;
+            first = second;
+            second = swap;
+        }
+        parent[second] = first;
+        setSize[first] += setSize[second];
+        sets--;
+        return true;
+        /* complejidad: o(alfa(n)) amortizado */
+    }
+
+    bool connected(int first, int second) {
+        return find(first) == find(second);
+    }
+
+    /* tamaño del conjunto que contiene al elemento */
+    int getSetSize(int element) {
+        return setSize[find(element)];
+    }
+};
+
+#endif
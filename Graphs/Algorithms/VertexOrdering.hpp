@@ -0,0 +1,139 @@
+#ifndef VERTEXORDERING_H
+#define VERTEXORDERING_H
+
+#include <cstddef>
+#include <vector>
+#include <algorithm> /* para sort y reverse */
+#include <utility> /* para pair */
+#include "../CsrView.hpp"
+#include "../Graph.hpp"
+#include "LiveIndices.hpp"
+
+/* estrategias para ordenar los vertices de modo que los vecinos queden en indices cercanos */
+enum ReorderStrategy {
+    REORDER_REVERSE_CUTHILL_MCKEE = 1, /* minimiza el ancho de banda: vecinos con indices proximos */
+    REORDER_DEGREE_DESCENDING = 2, /* los vertices de mayor grado primero: concentra las filas mas visitadas */
+    REORDER_BFS = 3 /* orden de descubrimiento de un recorrido en anchura */
+};
+
+/* metodo auxiliar: indices vivos ordenados por grado (ascendente o descendente) con un ordenamiento por conteo
+a igual grado se conserva el orden de indice */
+template <typename LivePredicate>
+std::vector<int> verticesByDegree(const CsrView& view, LivePredicate isLive, bool descending) {
+    int slots = view.getVertexSlots();
+    int maxDegree = 0;
+    for (int v = 0; v < slots; v++) {
+        if (isLive(v) && view.degree(v) > maxDegree) maxDegree = view.degree(v);
+    }
+    std::vector<int> start(maxDegree + 2, 0);
+    for (int v = 0; v < slots; v++) {
+        if (!isLive(v)) continue;
+        int key = descending ? maxDegree - view.degree(v) : view.degree(v);
+        start[key + 1]++;
+    }
+    for (int k = 0; k <= maxDegree; k++) {
+        start[k + 1] += start[k];
+    }
+    std::vector<int> order(start[maxDegree + 1]);
+    for (int v = 0; v < slots; v++) {
+        if (!isLive(v)) continue;
+        int key = descending ? maxDegree - view.degree(v) : view.degree(v);
+        order[start[key]++] = v;
+    }
+    return order;
+    /* complejidad: o(n + grado maximo) */
+}
+
+/* orden de grado descendente */
+template <typename LivePredicate>
+std::vector<int> degreeDescendingOrder(const CsrView& view, LivePredicate isLive) {
+    return verticesByDegree(view, isLive, true);
+}
+
+/* metodo auxiliar: recorridos en anchura desde cada vertice de starts todavia no visitado, en el orden de starts
+con byDegree los vecinos descubiertos desde un mismo vertice se encolan por grado ascendente (cuthill-mckee) */
+template <typename LivePredicate>
+std::vector<int> breadthFirstFrom(const CsrView& view, LivePredicate isLive,
+                                  const std::vector<int>& starts, bool byDegree) {
+    int slots = view.getVertexSlots();
+    std::vector<bool> visited(slots, false);
+    std::vector<int> order;
+    order.reserve(starts.size());
+    std::vector<std::pair<int, int> > discovered;
+    for (std::size_t s = 0; s < starts.size(); s++) {
+        if (visited[starts[s]]) continue;
+        visited[starts[s]] = true;
+        /* el propio vector de salida hace de cola */
+        std::size_t head = order.size();
+        order.push_back(starts[s]);
+        while (head < order.size()) {
+            int u = order[head++];
+            discovered.clear();
+            for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+                int v = view.target(e);
+                if (visited[v] || !isLive(v)) continue;
+                visited[v] = true;
+                discovered.push_back(std::make_pair(byDegree ? view.degree(v) : 0, v));
+            }
+            if (byDegree) std::sort(discovered.begin(), discovered.end());
+            for (std::size_t k = 0; k < discovered.size(); k++) {
+                order.push_back(discovered[k].second);
+            }
+        }
+    }
+    return order;
+    /* complejidad: o(n + m), o(n + m log d) con byDegree */
+}
+
+/* cuthill-mckee inverso: cada componente empieza en su vertice de menor grado (aproximacion de un vertice
+periferico), los vecinos se encolan por grado ascendente y al final se invierte el orden completo */
+template <typename LivePredicate>
+std::vector<int> reverseCuthillMcKeeOrder(const CsrView& view, LivePredicate isLive) {
+    std::vector<int> order = breadthFirstFrom(view, isLive, verticesByDegree(view, isLive, false), true);
+    std::reverse(order.begin(), order.end());
+    return order;
+    /* complejidad: o(n + m log d) */
+}
+
+/* orden de un recorrido en anchura: cada componente empieza en su vertice de mayor grado y los vecinos
+se encolan en el orden de su fila */
+template <typename LivePredicate>
+std::vector<int> breadthFirstOrder(const CsrView& view, LivePredicate isLive) {
+    return breadthFirstFrom(view, isLive, verticesByDegree(view, isLive, true), false);
+    /* complejidad: o(n + m) */
+}
+
+/* calcula el orden de los indices vivos segun la estrategia: order[r] es el indice que pasa a la posicion r */
+template <typename LivePredicate>
+std::vector<int> vertexOrder(const CsrView& view, ReorderStrategy strategy, LivePredicate isLive) {
+    switch (strategy) {
+        case REORDER_DEGREE_DESCENDING: return degreeDescendingOrder(view, isLive);
+        case REORDER_BFS: return breadthFirstOrder(view, isLive);
+        default: return reverseCuthillMcKeeOrder(view, isLive);
+    }
+}
+
+/* ancho de banda medio de una instantanea: promedio de |u - v| sobre sus entradas, una medida de la localidad
+de los accesos (cuanto menor, mas cerca en memoria quedan los datos de los vecinos) */
+inline double averageBandwidth(const CsrView& view) {
+    double total = 0.0;
+    for (int u = 0; u < view.getVertexSlots(); u++) {
+        for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+            int gap = view.target(e) - u;
+            total += gap < 0 ? -gap : gap;
+        }
+    }
+    return view.getEntryCount() > 0 ? total / view.getEntryCount() : 0.0;
+    /* complejidad: o(n + m) */
+}
+
+/* reordena los vertices del grafo segun la estrategia: renumera sus indices y reconstruye el almacenamiento de
+vertices y aristas en el orden nuevo (ver Graph::renumber). retorna la traduccion de los indices anteriores */
+template <typename T, typename W>
+std::vector<int> reorder(Graph<T, W>& graph, ReorderStrategy strategy = REORDER_REVERSE_CUTHILL_MCKEE) {
+    std::vector<int> order = vertexOrder(graph.freeze(), strategy, GraphIndexLive<T, W>(graph));
+    return graph.renumber(order);
+    /* complejidad: o(n + m log d) */
+}
+
+#endif
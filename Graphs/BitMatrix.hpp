@@ -0,0 +1,134 @@
+#ifndef BITMATRIX_H
+#define BITMATRIX_H
+
+#include <cstddef>
+#include <vector>
+#include <climits> /* para CHAR_BIT */
+#include "Algorithms/Bitset.hpp" /* para popCount */
+
+/* matriz cuadrada de bits empaquetada por filas, indexada por los indices internos de los vertices
+cada fila ocupa un numero de palabras multiplo de un bloque de 256 bits, asi que las operaciones entre filas
+recorren bloques completos sin casos de borde y el compilador puede vectorizarlas */
+class BitMatrix {
+private:
+    std::vector<unsigned long> bits; /* filas consecutivas de rowWords palabras cada una */
+    int dimension; /* numero de filas (y de columnas) */
+    int rowWords; /* palabras por fila */
+
+    static int bitsPerWord() { return static_cast<int>(sizeof(unsigned long) * CHAR_BIT); }
+
+    /* palabras por bloque de 256 bits */
+    static int blockWords() { return 256 / bitsPerWord(); }
+
+    /* palabras por fila para una dimension dada, redondeadas a bloques completos */
+    static int wordsFor(int columns) {
+        int words = (columns + bitsPerWord() - 1) / bitsPerWord();
+        return (words + blockWords() - 1) / blockWords() * blockWords();
+    }
+
+public:
+    BitMatrix() : dimension(0), rowWords(0) {}
+    explicit BitMatrix(int newDimension) : dimension(0), rowWords(0) {
+        resize(newDimension);
+    }
+
+    int getDimension() const { return dimension; }
+    int getRowWords() const { return rowWords; }
+    std::size_t getMemoryBytes() const { return bits.size() * sizeof(unsigned long); }
+
+    /* cambia la dimension conservando los bits de las filas y columnas que siguen dentro de la matriz */
+    void resize(int newDimension) {
+        int newRowWords = wordsFor(newDimension);
+        std::vector<unsigned long> newBits(static_cast<std::size_t>(newDimension) * newRowWords, 0UL);
+        int rows = dimension < newDimension ? dimension : newDimension;
+        int words = rowWords < newRowWords ? rowWords : newRowWords;
+        for (int r = 0; r < rows; r++) {
+            for (int w = 0; w < words; w++) {
+                newBits[static_cast<std::size_t>(r) * newRowWords + w] = bits[static_cast<std::size_t>(r) * rowWords + w];
+            }
+            /* al achicar, apaga las columnas que quedaron fuera de la matriz */
+            for (int c = newDimension; c < words * bitsPerWord(); c++) {
+                newBits[static_cast<std::size_t>(r) * newRowWords + c / bitsPerWord()] &= ~(1UL << (c % bitsPerWord()));
+            }
+        }
+        bits.swap(newBits);
+        dimension = newDimension;
+        rowWords = newRowWords;
+        /* complejidad: o(n^2 / bitsPerWord()) */
+    }
+
+    /* apaga todos los bits y libera la memoria */
+    void clear() {
+        std::vector<unsigned long>().swap(bits);
+        dimension = rowWords = 0;
+    }
+
+    /* puntero a las palabras de una fila */
+    const unsigned long* row(int r) const { return &bits[static_cast<std::size_t>(r) * rowWords]; }
+
+    bool test(int r, int c) const {
+        return (row(r)[c / bitsPerWord()] >> (c % bitsPerWord())) & 1UL;
+        /* complejidad: o(1) */
+    }
+    void set(int r, int c) {
+        bits[static_cast<std::size_t>(r) * rowWords + c / bitsPerWord()] |= 1UL << (c % bitsPerWord());
+    }
+    void reset(int r, int c) {
+        bits[static_cast<std::size_t>(r) * rowWords + c / bitsPerWord()] &= ~(1UL << (c % bitsPerWord()));
+    }
+
+    /* apaga todos los bits de una fila */
+    void clearRow(int r) {
+        unsigned long* words = &bits[static_cast<std::size_t>(r) * rowWords];
+        for (int w = 0; w < rowWords; w++) {
+            words[w] = 0UL;
+        }
+        /* complejidad: o(n / bitsPerWord()) */
+    }
+
+    /* numero de bits encendidos en una fila */
+    int rowCount(int r) const {
+        const unsigned long* words = row(r);
+        int count = 0;
+        for (int w = 0; w < rowWords; w++) {
+            count += popCount(words[w]);
+        }
+        return count;
+        /* complejidad: o(n / bitsPerWord()) */
+    }
+
+    /* numero de columnas encendidas a la vez en dos filas (popcount de su interseccion)
+    procesa un bloque de 256 bits por vuelta con cuatro acumuladores independientes */
+    int intersectionCount(int first, int second) const {
+        const unsigned long* a = row(first);
+        const unsigned long* b = row(second);
+        int count0 = 0, count1 = 0, count2 = 0, count3 = 0;
+        for (int w = 0; w < rowWords; w += 4) {
+            count0 += popCount(a[w] & b[w]);
+            count1 += popCount(a[w + 1] & b[w + 1]);
+            count2 += popCount(a[w + 2] & b[w + 2]);
+            count3 += popCount(a[w + 3] & b[w + 3]);
+        }
+        return count0 + count1 + count2 + count3;
+        /* complejidad: o(n / bitsPerWord()) */
+    }
+
+    /* primera columna encendida de una fila en [from, dimension), o -1 si no hay */
+    int nextInRow(int r, int from) const {
+        if (from >= dimension) return -1;
+        const unsigned long* words = row(r);
+        int w = from / bitsPerWord();
+        unsigned long word = words[w] & (~0UL << (from % bitsPerWord()));
+        while (true) {
+            if (word != 0UL) {
+                /* posicion del bit encendido mas bajo: cuenta los ceros a su derecha */
+                return w * bitsPerWord() + popCount((word & (~word + 1UL)) - 1UL);
+            }
+            if (++w >= rowWords) return -1;
+            word = words[w];
+        }
+        /* complejidad: o(n / bitsPerWord()) en el peor caso, o(1) amortizado al recorrer una fila */
+    }
+};
+
+#endif
@@ -0,0 +1,261 @@
+#ifndef COMPRESSEDADJACENCY_H
+#define COMPRESSEDADJACENCY_H
+
+#include <cstddef>
+#include <vector>
+#include "CsrView.hpp"
+
+/* como se guardan los pesos en una adyacencia comprimida */
+enum WeightStorage {
+    WEIGHTS_NONE = 0, /* no se guardan: weight() devuelve 1.0 */
+    WEIGHTS_QUANTIZED = 1, /* 16 bits por entrada, cuantizados linealmente entre el peso minimo y el maximo */
+    WEIGHTS_FLOAT = 2, /* precision simple, 4 bytes por entrada */
+    WEIGHTS_EXACT = 3 /* double, 8 bytes por entrada */
+};
+
+/* adyacencia de solo lectura comprimida con diferencias y enteros de longitud variable (varint)
+cada fila empieza con su grado; el primer vecino se guarda como la diferencia con el propio indice de la fila
+(en zigzag, porque puede ser negativa) y los siguientes como la diferencia con el vecino anterior, que nunca es
+negativa porque las filas de la instantanea estan ordenadas. cada valor ocupa 7 bits por byte, con el bit alto
+indicando que sigue otro byte, asi que las diferencias pequeñas (vecinos con indices cercanos, por ejemplo
+despues de reorder) ocupan un byte. los pesos se guardan aparte, en un arreglo indexado por entrada, para
+que los recorridos que no los usan no los lean */
+class CompressedAdjacency {
+private:
+    std::vector<unsigned char> bytes; /* filas codificadas, una tras otra */
+    /* el inicio de cada fila se guarda en dos niveles: una base de 64 bits por bloque de 64 filas, porque los bytes
+    codificados pueden pasar de 4 GiB (hasta 5 por vecino), y un desplazamiento de 32 bits desde esa base por fila;
+    la tabla por fila ocupa la mitad que con size_t, y es la que se lee de forma aleatoria en cada recorrido */
+    std::vector<unsigned int> rowOffset; /* byte de inicio de la fila de cada indice desde la base de su bloque (indices + 1) */
+    std::vector<std::size_t> blockBase; /* byte donde empieza cada bloque de filas (indices / 64 + 1) */
+    std::vector<int> entryStart; /* primera entrada de cada fila, solo si se guardan pesos */
+    std::vector<unsigned short> quantized; /* pesos cuantizados (WEIGHTS_QUANTIZED) */
+    std::vector<float> singleWeights; /* pesos en precision simple (WEIGHTS_FLOAT) */
+    std::vector<double> exactWeights; /* pesos exactos (WEIGHTS_EXACT) */
+    WeightStorage storage; /* forma de guardar los pesos */
+    double minWeight; /* peso minimo, origen de la cuantizacion */
+    double weightStep; /* diferencia de peso entre dos valores cuantizados consecutivos */
+    int entryCount; /* entradas de adyacencia */
+    unsigned long version; /* version de la instantanea de origen */
+
+    static const int blockShift = 6; /* 64 filas por bloque */
+
+    /* primer byte de la fila de un indice */
+    const unsigned char* rowBegin(int vertex) const {
+        return &bytes[0] + blockBase[vertex >> blockShift] + rowOffset[vertex];
+    }
+
+    static void writeVarint(std::vector<unsigned char>& out, unsigned int value) {
+        while (value >= 0x80U) {
+            out.push_back(static_cast<unsigned char>(value | 0x80U));
+            value >>= 7;
+        }
+        out.push_back(static_cast<unsigned char>(value));
+    }
+
+    /* zigzag: 0, -1, 1, -2, ... se codifican como 0, 1, 2, 3, ... */
+    static unsigned int zigzag(int value) {
+        return value < 0 ? (static_cast<unsigned int>(-(value + 1)) << 1) | 1U : static_cast<unsigned int>(value) << 1;
+    }
+    static int unzigzag(unsigned int value) {
+        return (value & 1U) ? -static_cast<int>(value >> 1) - 1 : static_cast<int>(value >> 1);
+    }
+
+public:
+    /* lee un varint y avanza el puntero; el caso de un byte se resuelve sin ciclo */
+    static unsigned int readVarint(const unsigned char*& in) {
+        unsigned int value = *in++;
+        if (value < 0x80U) return value;
+        value &= 0x7FU;
+        int shift = 7;
+        unsigned int byte;
+        do {
+            byte = *in++;
+            value |= (byte & 0x7FU) << shift;
+            shift += 7;
+        } while (byte >= 0x80U);
+        return value;
+    }
+
+    /* cursor sobre los vecinos de una fila, en orden creciente de indice
+    decodifica un vecino por adelantado: el constructor resuelve el primero (el unico en zigzag), asi next no
+    distingue el primer vecino y la diferencia de un byte, el caso comun, se lee sin llamar a readVarint */
+    class RowCursor {
+    private:
+        const unsigned char* in; /* siguiente byte por decodificar */
+        int remaining; /* vecinos que faltan, incluido el ya decodificado */
+        int upcoming; /* siguiente vecino, ya decodificado si remaining > 0 */
+
+    public:
+        RowCursor(const CompressedAdjacency& adjacency, int vertex)
+            : in(adjacency.rowBegin(vertex)), upcoming(vertex) {
+            remaining = static_cast<int>(readVarint(in));
+            if (remaining > 0) upcoming += unzigzag(readVarint(in));
+        }
+
+        /* entrega el siguiente vecino en target; retorna false al terminar la fila */
+        bool next(int& target) {
+            if (remaining == 0) return false;
+            target = upcoming;
+            if (--remaining > 0) {
+                unsigned int gap = *in;
+                if (gap < 0x80U) {
+                    in++;
+                } else {
+                    gap = readVarint(in);
+                }
+                upcoming += static_cast<int>(gap);
+            }
+            return true;
+        }
+    };
+
+    CompressedAdjacency() : rowOffset(1, 0), blockBase(1, 0), storage(WEIGHTS_NONE), minWeight(0), weightStep(0), entryCount(0), version(0) {}
+
+    explicit CompressedAdjacency(const CsrView& view, WeightStorage newStorage = WEIGHTS_NONE)
+        : storage(WEIGHTS_NONE), minWeight(0), weightStep(0), entryCount(0), version(0) {
+        build(view, newStorage);
+    }
+
+    /* codifica una instantanea csr (sus filas deben estar ordenadas, como las que construye freeze)
+    retorna false, dejando la adyacencia vacia, si un bloque de 64 filas ocupa mas de 4 GiB codificado
+    (mas de unos 850 millones de vecinos en esas filas) */
+    bool build(const CsrView& view, WeightStorage newStorage = WEIGHTS_NONE) {
+        int slots = view.getVertexSlots();
+        storage = newStorage;
+        entryCount = view.getEntryCount();
+        version = view.getVersion();
+        std::vector<unsigned char>().swap(bytes);
+        std::vector<int>().swap(entryStart);
+        std::vector<unsigned short>().swap(quantized);
+        std::vector<float>().swap(singleWeights);
+        std::vector<double>().swap(exactWeights);
+        minWeight = weightStep = 0.0;
+        rowOffset.assign(slots + 1, 0);
+        blockBase.assign((slots >> blockShift) + 1, 0);
+        /* estimacion inicial: un byte por grado y dos por vecino */
+        bytes.reserve(static_cast<std::size_t>(slots) + 2 * static_cast<std::size_t>(entryCount) + 1);
+        for (int v = 0; v <= slots; v++) {
+            if ((v & ((1 << blockShift) - 1)) == 0) blockBase[v >> blockShift] = bytes.size();
+            std::size_t offset = bytes.size() - blockBase[v >> blockShift];
+            if (offset > 0xffffffffUL) {
+                /**/ /* error: el desplazamiento dentro del bloque no cabe en 32 bits */
+                std::vector<unsigned char>(1, 0).swap(bytes);
+                rowOffset.assign(1, 0);
+                blockBase.assign(1, 0);
+                storage = WEIGHTS_NONE;
+                entryCount = 0;
+                return false;
+            }
+            rowOffset[v] = static_cast<unsigned int>(offset);
+            if (v == slots) break;
+            int begin = view.edgeBegin(v);
+            int end = view.edgeEnd(v);
+            writeVarint(bytes, static_cast<unsigned int>(end - begin));
+            int last = v;
+            for (int e = begin; e < end; e++) {
+                int target = view.target(e);
+                writeVarint(bytes, e == begin ? zigzag(target - last) : static_cast<unsigned int>(target - last));
+                last = target;
+            }
+        }
+        /* un byte de relleno para que &bytes[0] sea valido aun sin indices */
+        bytes.push_back(0);
+        std::vector<unsigned char>(bytes).swap(bytes);
+
+        if (storage == WEIGHTS_NONE) return true;
+        entryStart.assign(view.getOffsets().begin(), view.getOffsets().end());
+        const std::vector<double>& weights = view.getWeights();
+        if (storage == WEIGHTS_EXACT) {
+            exactWeights = weights;
+        } else if (storage == WEIGHTS_FLOAT) {
+            singleWeights.assign(weights.begin(), weights.end());
+        } else {
+            double maxWeight = 0.0;
+            for (int e = 0; e < entryCount; e++) {
+                if (e == 0 || weights[e] < minWeight) minWeight = weights[e];
+                if (e == 0 || weights[e] > maxWeight) maxWeight = weights[e];
+            }
+            weightStep = (maxWeight - minWeight) / 65535.0;
+            quantized.resize(entryCount);
+            for (int e = 0; e < entryCount; e++) {
+                quantized[e] = weightStep > 0.0
+                    ? static_cast<unsigned short>((weights[e] - minWeight) / weightStep + 0.5) : 0;
+            }
+        }
+        return true;
+        /* complejidad: o(n + m) */
+    }
+
+    int getVertexSlots() const { return static_cast<int>(rowOffset.size()) - 1; }
+    int getEntryCount() const { return entryCount; }
+    unsigned long getVersion() const { return version; }
+    WeightStorage getWeightStorage() const { return storage; }
+
+    bool containsIndex(int vertex) const {
+        return vertex >= 0 && vertex < getVertexSlots();
+    }
+
+    /* grado de un indice: el primer varint de su fila */
+    int degree(int vertex) const {
+        const unsigned char* in = rowBegin(vertex);
+        return static_cast<int>(readVarint(in));
+        /* complejidad: o(1) */
+    }
+
+    /* vecinos de una fila decodificados en out (se agregan al final) */
+    void decodeRow(int vertex, std::vector<int>& out) const {
+        RowCursor cursor(*this, vertex);
+        int target;
+        while (cursor.next(target)) out.push_back(target);
+        /* complejidad: o(grado(vertex)) */
+    }
+
+    /* peso de la k-esima entrada de la fila de un indice (1.0 si no se guardan pesos)
+    con WEIGHTS_QUANTIZED el error es a lo sumo la mitad de (peso maximo - peso minimo) / 65535 */
+    double weight(int vertex, int k) const {
+        if (storage == WEIGHTS_NONE) return 1.0;
+        int entry = entryStart[vertex] + k;
+        if (storage == WEIGHTS_EXACT) return exactWeights[entry];
+        if (storage == WEIGHTS_FLOAT) return singleWeights[entry];
+        return minWeight + quantized[entry] * weightStep;
+    }
+
+    /* busca destination en la fila de source decodificandola hasta alcanzarlo; -1 si no existe, si no su posicion k */
+    int findEdge(int source, int destination) const {
+        if (!containsIndex(source)) return -1;
+        RowCursor cursor(*this, source);
+        int target;
+        for (int k = 0; cursor.next(target); k++) {
+            if (target == destination) return k;
+            if (target > destination) break;
+        }
+        return -1;
+        /* complejidad: o(grado(source)) */
+    }
+
+    bool containsEdge(int source, int destination) const {
+        return findEdge(source, destination) >= 0;
+    }
+
+    /* peso de la arista source -> destination, o -1.0 si no existe */
+    double edgeWeight(int source, int destination) const {
+        int k = findEdge(source, destination);
+        return k >= 0 ? weight(source, k) : -1.0;
+    }
+
+    /* bytes ocupados por la adyacencia y los pesos */
+    std::size_t getMemoryBytes() const {
+        return bytes.capacity() + rowOffset.capacity() * sizeof(unsigned int) + blockBase.capacity() * sizeof(std::size_t)
+            + entryStart.capacity() * sizeof(int)
+            + quantized.capacity() * sizeof(unsigned short) + singleWeights.capacity() * sizeof(float)
+            + exactWeights.capacity() * sizeof(double);
+    }
+
+    /* bytes de la adyacencia sin los pesos */
+    std::size_t getAdjacencyBytes() const {
+        return bytes.capacity() + rowOffset.capacity() * sizeof(unsigned int) + blockBase.capacity() * sizeof(std::size_t);
+    }
+};
+
+#endif
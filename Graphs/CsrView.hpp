@@ -0,0 +1,143 @@
+#ifndef CSRVIEW_H
+#define CSRVIEW_H
+
+#include <cstddef>
+#include <vector>
+
+/* instantanea inmutable de la adyacencia de un grafo en formato de filas dispersas comprimidas (csr)
+las filas se indexan con los indices internos del grafo (dataToIndex/indexToData) y cada fila guarda
+sus vecinos ordenados por indice, de modo que recorrer los vecinos de un vertice lee memoria contigua */
+class CsrView {
+private:
+    std::vector<int> offsets; /* offsets[v]..offsets[v + 1] delimitan la fila del vertice v */
+    std::vector<int> neighbors; /* indices de los vertices adyacentes, fila por fila */
+    std::vector<double> weights; /* peso de cada arista, paralelo al vector neighbors */
+    unsigned long version; /* version del grafo a partir de la cual se construyo la instantanea */
+
+public:
+    CsrView() : offsets(1, 0), version(0) {}
+
+    /* toma posesion de los arreglos construidos por el grafo (intercambio en o(1), sin copias) */
+    void adopt(std::vector<int>& newOffsets, std::vector<int>& newNeighbors,
+               std::vector<double>& newWeights, unsigned long newVersion) {
+        offsets.swap(newOffsets);
+        neighbors.swap(newNeighbors);
+        weights.swap(newWeights);
+        version = newVersion;
+    }
+
+    /* toma posesion de los arreglos de otra instantanea, que queda vacia */
+    void adopt(CsrView& other, unsigned long newVersion) {
+        adopt(other.offsets, other.neighbors, other.weights, newVersion);
+        other.release();
+    }
+
+    /* libera la memoria de la instantanea y la deja vacia */
+    void release() {
+        std::vector<int>(1, 0).swap(offsets);
+        std::vector<int>().swap(neighbors);
+        std::vector<double>().swap(weights);
+        version = 0;
+    }
+
+    unsigned long getVersion() const { return version; }
+
+    /* arreglos completos de la instantanea, para volcarlos en bloque (por ejemplo al guardarla en un archivo) */
+    const std::vector<int>& getOffsets() const { return offsets; }
+    const std::vector<int>& getNeighbors() const { return neighbors; }
+    const std::vector<double>& getWeights() const { return weights; }
+
+    /* numero de indices cubiertos por la instantanea (incluye indices de vertices eliminados, con fila vacia) */
+    int getVertexSlots() const { return static_cast<int>(offsets.size()) - 1; }
+    /* numero de entradas de adyacencia (en un grafo no dirigido cada arista aparece dos veces) */
+    int getEntryCount() const { return static_cast<int>(neighbors.size()); }
+
+    /* limites de la fila de un vertice: las entradas validas son [edgeBegin(v), edgeEnd(v)) */
+    int edgeBegin(int vertex) const { return offsets[vertex]; }
+    int edgeEnd(int vertex) const { return offsets[vertex + 1]; }
+    int degree(int vertex) const { return offsets[vertex + 1] - offsets[vertex]; }
+
+    /* cursor sobre los vecinos de una fila, con la misma interfaz que el de CompressedAdjacency
+    para que los recorridos puedan escribirse una sola vez para ambas representaciones */
+    class RowCursor {
+    private:
+        const int* current; /* siguiente vecino */
+        const int* end; /* fin de la fila */
+
+    public:
+        RowCursor(const CsrView& view, int vertex)
+            : current(view.neighbors.empty() ? NULL : &view.neighbors[0] + view.offsets[vertex]),
+              end(current + (view.offsets[vertex + 1] - view.offsets[vertex])) {}
+
+        bool next(int& target) {
+            if (current == end) return false;
+            target = *current++;
+            return true;
+        }
+    };
+
+    /* vertice destino y peso de una entrada de adyacencia */
+    int target(int edge) const { return neighbors[edge]; }
+    double weight(int edge) const { return weights[edge]; }
+
+    /* verifica si un indice pertenece a la instantanea */
+    bool containsIndex(int vertex) const {
+        return vertex >= 0 && vertex < getVertexSlots();
+    }
+
+    /* busca la entrada de la arista source -> destination, devuelve -1 si no existe */
+    int findEdge(int source, int destination) const {
+        if (!containsIndex(source)) return -1;
+        /* busqueda binaria sobre la fila ordenada del vertice de origen */
+        int low = offsets[source];
+        int high = offsets[source + 1];
+        while (low < high) {
+            int middle = low + (high - low) / 2;
+            if (neighbors[middle] < destination) {
+                low = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+        return (low < offsets[source + 1] && neighbors[low] == destination) ? low : -1;
+        /* complejidad: o(log grado(source)) */
+    }
+
+    bool containsEdge(int source, int destination) const {
+        return findEdge(source, destination) >= 0;
+    }
+
+    /* peso de la arista source -> destination, o -1.0 si no existe */
+    double edgeWeight(int source, int destination) const {
+        int edge = findEdge(source, destination);
+        return edge >= 0 ? weights[edge] : -1.0;
+        /* complejidad: o(log grado(source)) */
+    }
+
+    /* construye en out la instantanea transpuesta (cada arista invertida), con la misma version
+    recorrer los origenes en orden deja cada fila de out ya ordenada, por lo que no hace falta ordenar */
+    void transposeInto(CsrView& out) const {
+        int slots = getVertexSlots();
+        std::vector<int> newOffsets(slots + 1, 0);
+        for (std::size_t e = 0; e < neighbors.size(); e++) {
+            newOffsets[neighbors[e] + 1]++;
+        }
+        for (int i = 0; i < slots; i++) {
+            newOffsets[i + 1] += newOffsets[i];
+        }
+        std::vector<int> cursor(newOffsets.begin(), newOffsets.end() - 1);
+        std::vector<int> newNeighbors(neighbors.size());
+        std::vector<double> newWeights(weights.size());
+        for (int source = 0; source < slots; source++) {
+            for (int e = offsets[source]; e < offsets[source + 1]; e++) {
+                int pos = cursor[neighbors[e]]++;
+                newNeighbors[pos] = source;
+                newWeights[pos] = weights[e];
+            }
+        }
+        out.adopt(newOffsets, newNeighbors, newWeights, version);
+        /* complejidad: o(n + m) */
+    }
+};
+
+#endif
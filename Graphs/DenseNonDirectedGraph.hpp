@@ -0,0 +1,356 @@
+#ifndef DENSENONDIRECTEDGRAPH_H
+#define DENSENONDIRECTEDGRAPH_H
+
+#include "Graph.hpp"
+#include "BitMatrix.hpp"
+#include <vector>
+#include <utility> /* para pair */
+
+/*
+ * @brief Grafo no dirigido con la adyacencia guardada en una matriz de bits.
+ * Pensado para grafos densos (densidad mayor a ~10%): cada arista ocupa un bit en la fila de cada
+ * extremo en lugar de dos nodos adyacentes, y verificar una arista es leer un bit. Opcionalmente
+ * guarda los pesos en una matriz paralela de n x n valores; sin ella, toda arista pesa 1.0.
+ * Los vértices siguen usando el sistema de mapeo de la clase base y sus listas de adyacencia quedan vacías.
+ * Un lazo ocupa un único bit, por lo que cuenta una sola vez en el grado del vértice.
+ *
+ * @tparam T El tipo de dato almacenado en los vértices del grafo.
+ */
+template <typename T, typename W = double>
+class DenseNonDirectedGraph : public Graph<T, W> {
+public:
+    /*
+     * @brief Constructor de la clase DenseNonDirectedGraph.
+     *
+     * @param storeWeights Si es true, guarda el peso de cada arista en una matriz de n x n valores.
+     */
+    explicit DenseNonDirectedGraph(bool storeWeights = false) : Graph<T, W>(), weighted(storeWeights) {}
+
+    /*
+     * @brief Constructor de copia de la clase DenseNonDirectedGraph.
+     * La clase base copia los vértices con los mismos índices, así que la matriz se copia tal cual.
+     *
+     * @param other El grafo denso del cual se creará una copia.
+     */
+    DenseNonDirectedGraph(const DenseNonDirectedGraph<T, W>& other) : Graph<T, W>(other), weighted(other.weighted) {
+        this->finishCopy(other);
+    }
+
+    /*
+     * @brief Destructor virtual de la clase DenseNonDirectedGraph.
+     */
+    virtual ~DenseNonDirectedGraph() {}
+
+    /*
+     * @brief Agrega un nuevo vértice y, si su índice no cabe en la matriz, duplica su dimensión.
+     *
+     * @param data El dato a almacenar en el nuevo vértice.
+     */
+    virtual void addVertex(const T& data) {
+        if (this->findVertex(data) != NULL) return;
+        VertexNode<T, W>* newNode = this->createVertexNode(data, NULL);
+        if (!newNode) return;
+        if (!this->addToMappings(newNode)) {
+            this->destroyVertexNode(newNode);
+            return;
+        }
+        /* Un índice reciclado trae su fila y su columna vacías: removeVertex las limpió. */
+        ensureDimension(newNode->getIndex() + 1);
+        this->linkVertex(newNode);
+        this->vertexCount++;
+        this->markModified();
+    }
+
+    /*
+     * @brief Elimina un vértice y todas sus aristas.
+     * Recorre los bits encendidos de su fila para apagar su columna en la fila de cada vecino.
+     *
+     * @param data El dato del vértice a eliminar.
+     */
+    virtual void removeVertex(const T& data) {
+        VertexNode<T, W>* toRemove = this->findVertex(data);
+        if (!toRemove) return;
+        int index = toRemove->getIndex();
+        int deletedEdges = 0;
+        for (int v = adjacency.nextInRow(index, 0); v >= 0; v = adjacency.nextInRow(index, v + 1)) {
+            if (v != index) {
+                adjacency.reset(v, index);
+                this->indexToNode[v]->setDegree(this->indexToNode[v]->getDegree() - 1);
+            }
+            deletedEdges++;
+        }
+        adjacency.clearRow(index);
+        this->edgeCount -= deletedEdges;
+
+        this->unlinkVertex(toRemove);
+        this->removeFromMappings(data);
+        this->vertexCount--;
+        this->destroyVertexNode(toRemove);
+        this->markModified();
+        /* complejidad: o(n / bitsPerWord() + grado) */
+    }
+
+    /*
+     * @brief Agrega una arista no dirigida encendiendo un bit en la fila de cada extremo.
+     *
+     * @param source El dato del vértice de origen.
+     * @param destination El dato del vértice de destino.
+     * @param weight El peso de la arista (se ignora si el grafo no guarda pesos).
+     */
+    virtual void addEdge(const T& source, const T& destination, const W& weight = W(1)) {
+        VertexNode<T, W>* sourceVertex = this->findVertex(source);
+        VertexNode<T, W>* destinationVertex = this->findVertex(destination);
+        if (!sourceVertex || !destinationVertex) return;
+        int s = sourceVertex->getIndex();
+        int d = destinationVertex->getIndex();
+        if (adjacency.test(s, d)) return;
+        adjacency.set(s, d);
+        adjacency.set(d, s);
+        if (weighted) {
+            weights[cell(s, d)] = weights[cell(d, s)] = weight;
+        }
+        sourceVertex->setDegree(sourceVertex->getDegree() + 1);
+        if (d != s) destinationVertex->setDegree(destinationVertex->getDegree() + 1);
+        this->edgeCount++;
+        this->markModified();
+        /* complejidad promedio: o(1) */
+    }
+
+    /*
+     * @brief Elimina una arista no dirigida apagando sus dos bits.
+     *
+     * @param source El dato del vértice de origen.
+     * @param destination El dato del vértice de destino.
+     */
+    virtual void removeEdge(const T& source, const T& destination) {
+        VertexNode<T, W>* sourceVertex = this->findVertex(source);
+        VertexNode<T, W>* destinationVertex = this->findVertex(destination);
+        if (!sourceVertex || !destinationVertex) return;
+        int s = sourceVertex->getIndex();
+        int d = destinationVertex->getIndex();
+        if (!adjacency.test(s, d)) return;
+        adjacency.reset(s, d);
+        adjacency.reset(d, s);
+        sourceVertex->setDegree(sourceVertex->getDegree() - 1);
+        if (d != s) destinationVertex->setDegree(destinationVertex->getDegree() - 1);
+        this->edgeCount--;
+        this->markModified();
+        /* complejidad promedio: o(1) */
+    }
+
+    /*
+     * @brief Verifica si dos vértices son adyacentes con una sola lectura de bit.
+     */
+    virtual bool areAdjacent(const T& source, const T& destination) const {
+        return containsEdge(source, destination);
+    }
+
+    virtual bool containsEdge(const T& source, const T& destination) const {
+        const int* s = this->dataToIndex.find(source);
+        const int* d = this->dataToIndex.find(destination);
+        return s != NULL && d != NULL && adjacency.test(*s, *d);
+        /* complejidad promedio: o(1) */
+    }
+
+    /*
+     * @brief Devuelve el peso de una arista (1.0 si el grafo no guarda pesos), o -1.0 si no existe.
+     */
+    virtual double edgeWeight(const T& source, const T& destination) const {
+        const int* s = this->dataToIndex.find(source);
+        const int* d = this->dataToIndex.find(destination);
+        if (s == NULL || d == NULL || !adjacency.test(*s, *d)) return -1.0;
+        return weighted ? static_cast<double>(weights[cell(*s, *d)]) : 1.0;
+        /* complejidad promedio: o(1) */
+    }
+
+    /*
+     * @brief Devuelve el peso de una arista con su tipo W (W(1) si el grafo no guarda pesos).
+     */
+    virtual OptionalWeight<W> findEdgeWeight(const T& source, const T& destination) const {
+        const int* s = this->dataToIndex.find(source);
+        const int* d = this->dataToIndex.find(destination);
+        if (s == NULL || d == NULL || !adjacency.test(*s, *d)) return OptionalWeight<W>();
+        return OptionalWeight<W>(weighted ? weights[cell(*s, *d)] : W(1));
+        /* complejidad promedio: o(1) */
+    }
+
+    virtual bool containsEdgeByIndex(int sourceIndex, int destIndex) const {
+        return this->containsVertexByIndex(sourceIndex) && this->containsVertexByIndex(destIndex)
+            && adjacency.test(sourceIndex, destIndex);
+        /* complejidad: o(1) */
+    }
+
+    virtual double edgeWeightByIndex(int sourceIndex, int destIndex) const {
+        if (!containsEdgeByIndex(sourceIndex, destIndex)) return -1.0;
+        return weighted ? static_cast<double>(weights[cell(sourceIndex, destIndex)]) : 1.0;
+        /* complejidad: o(1) */
+    }
+
+    /*
+     * @brief Libera la matriz y luego toda la memoria de la clase base.
+     */
+    virtual void clear() {
+        adjacency.clear();
+        std::vector<W>().swap(weights);
+        Graph<T, W>::clear();
+    }
+
+    /*
+     * @brief Cuenta los vecinos comunes de dos vértices con el popcount de la intersección de sus filas.
+     *
+     * @return El número de vecinos comunes, o -1 si alguno de los vértices no existe.
+     */
+    int commonNeighbors(const T& first, const T& second) const {
+        const int* a = this->dataToIndex.find(first);
+        const int* b = this->dataToIndex.find(second);
+        if (a == NULL || b == NULL) return -1;
+        return adjacency.intersectionCount(*a, *b);
+        /* complejidad: o(n / bitsPerWord()) */
+    }
+
+    /*
+     * @brief Cuenta los triángulos del grafo.
+     * Para cada arista (u, v) con u < v, el popcount de la intersección de las filas de u y v da los
+     * terceros vértices w; cada triángulo aparece una vez por cada una de sus tres aristas.
+     * Los lazos de u o v encienden su propio bit en ambas filas y se descuentan.
+     *
+     * @return El número de triángulos.
+     */
+    long countTriangles() const {
+        long total = 0;
+        int slots = adjacency.getDimension();
+        for (int u = 0; u < slots; u++) {
+            bool loopU = adjacency.test(u, u);
+            for (int v = adjacency.nextInRow(u, u + 1); v >= 0; v = adjacency.nextInRow(u, v + 1)) {
+                total += adjacency.intersectionCount(u, v) - (loopU ? 1 : 0) - (adjacency.test(v, v) ? 1 : 0);
+            }
+        }
+        return total / 3;
+        /* complejidad: o(m * n / bitsPerWord()) */
+    }
+
+    /*
+     * @brief Indica si el grafo guarda el peso de cada arista.
+     */
+    bool isWeighted() const { return weighted; }
+
+    /*
+     * @brief Devuelve la memoria ocupada por la matriz de bits y la de pesos, en bytes.
+     */
+    std::size_t getMatrixBytes() const {
+        return adjacency.getMemoryBytes() + weights.size() * sizeof(W);
+    }
+
+protected:
+    /*
+     * @brief Copia la matriz de otro grafo denso: los índices de los vértices coinciden con los del original.
+     *
+     * @param otherGraph El grafo denso del cual se copiarán las aristas.
+     * @return false si otherGraph no es un grafo denso.
+     */
+    virtual bool copyEdges(const Graph<T, W>& otherGraph) {
+        const DenseNonDirectedGraph<T, W>* otherDense = dynamic_cast<const DenseNonDirectedGraph<T, W>*>(&otherGraph);
+        if (!otherDense) return false;
+        adjacency = otherDense->adjacency;
+        weighted = otherDense->weighted;
+        weights = otherDense->weights;
+        /* Los nodos vértice se crearon de nuevo: recupera sus grados. */
+        for (int i = 0; i < static_cast<int>(this->indexToNode.size()); i++) {
+            if (this->indexToNode[i] != NULL) {
+                this->indexToNode[i]->setDegree(otherDense->indexToNode[i]->getDegree());
+            }
+        }
+        return true;
+    }
+
+    /*
+     * @brief Identifica a los grafos densos en los archivos de instantánea.
+     */
+    virtual unsigned int snapshotKind() const { return SNAPSHOT_DENSE_NON_DIRECTED; }
+
+    /*
+     * @brief Enciende los bits de cada entrada de la adyacencia CSR de un archivo (un lazo ocupa una sola entrada).
+     * Los pesos se conservan solo si este grafo guarda pesos.
+     *
+     * @param view La adyacencia leída del archivo.
+     * @return true: la matriz no asigna nodos, solo crece con ensureDimension.
+     */
+    virtual bool restoreEdges(const CsrView& view) {
+        int slots = view.getVertexSlots();
+        ensureDimension(slots);
+        for (int u = 0; u < slots; u++) {
+            if (this->indexToNode[u] == NULL) continue;
+            for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+                adjacency.set(u, view.target(e));
+                if (weighted) weights[cell(u, view.target(e))] = W(view.weight(e));
+            }
+            this->indexToNode[u]->setDegree(view.degree(u));
+        }
+        return true;
+    }
+
+    /*
+     * @brief Vuelca la fila de un índice para freeze; los bits ya salen ordenados por columna.
+     */
+    virtual void collectRow(int index, std::vector<std::pair<int, double> >& row) const {
+        for (int v = adjacency.nextInRow(index, 0); v >= 0; v = adjacency.nextInRow(index, v + 1)) {
+            row.push_back(std::make_pair(v, weighted ? static_cast<double>(weights[cell(index, v)]) : 1.0));
+        }
+    }
+
+    /*
+     * @brief Reconstruye la matriz con los índices nuevos después de compactIndices.
+     */
+    virtual void indicesRenumbered(const std::vector<int>& oldToNew) {
+        int slots = static_cast<int>(this->indexToNode.size());
+        BitMatrix renumbered(slots);
+        std::vector<W> renumberedWeights(weighted ? static_cast<std::size_t>(slots) * slots : 0);
+        for (int u = 0; u < static_cast<int>(oldToNew.size()); u++) {
+            if (oldToNew[u] < 0) continue;
+            for (int v = adjacency.nextInRow(u, 0); v >= 0; v = adjacency.nextInRow(u, v + 1)) {
+                renumbered.set(oldToNew[u], oldToNew[v]);
+                if (weighted) {
+                    renumberedWeights[static_cast<std::size_t>(oldToNew[u]) * slots + oldToNew[v]] = weights[cell(u, v)];
+                }
+            }
+        }
+        adjacency = renumbered;
+        weights.swap(renumberedWeights);
+        /* complejidad: o(n^2 / bitsPerWord() + m) */
+    }
+
+private:
+    BitMatrix adjacency; /* bit (u, v) encendido si existe la arista entre los índices u y v */
+    std::vector<W> weights; /* pesos en orden de filas, dimension x dimension valores (solo si weighted) */
+    bool weighted; /* indica si se guardan los pesos */
+
+    /*
+     * @brief Posición de la casilla (u, v) en la matriz de pesos.
+     */
+    std::size_t cell(int u, int v) const {
+        return static_cast<std::size_t>(u) * adjacency.getDimension() + v;
+    }
+
+    /*
+     * @brief Garantiza que la matriz cubra al menos un número de índices, duplicando su dimensión.
+     */
+    void ensureDimension(int required) {
+        int current = adjacency.getDimension();
+        if (required <= current) return;
+        int grown = current < 64 ? 64 : current * 2;
+        if (grown < required) grown = required;
+        adjacency.resize(grown);
+        if (weighted) {
+            std::vector<W> grownWeights(static_cast<std::size_t>(grown) * grown, W());
+            for (int u = 0; u < current; u++) {
+                for (int v = 0; v < current; v++) {
+                    grownWeights[static_cast<std::size_t>(u) * grown + v] = weights[static_cast<std::size_t>(u) * current + v];
+                }
+            }
+            weights.swap(grownWeights);
+        }
+        /* complejidad: o(n^2 / bitsPerWord()), o(n^2) con pesos; amortizado por la duplicación */
+    }
+};
+
+#endif
@@ -0,0 +1,395 @@
+#ifndef DIRECTEDGRAPH_H
+#define DIRECTEDGRAPH_H
+
+#include "Graph.hpp"
+#include <vector>
+
+/*
+ * @brief Clase derivada para representar un grafo dirigido.
+ * Hereda de la clase base Graph<T, W>. Cada vértice mantiene dos listas:
+ * la lista de adyacencia (aristas salientes) y la lista de aristas entrantes.
+ * Cada arista u -> v se guarda como una mitad saliente en la lista de u y una
+ * mitad entrante en la lista de v, enlazadas entre sí como gemelas, de modo que
+ * el grado de entrada, los predecesores y la eliminación de vértices cuestan O(grado).
+ *
+ * @tparam T El tipo de dato almacenado en los vértices del grafo.
+ */
+template <typename T, typename W = double>
+class DirectedGraph : public Graph<T, W> {
+public:
+    /*
+     * @brief Constructor predeterminado de la clase DirectedGraph.
+     * Llama al constructor de la clase base Graph<T, W>.
+     */
+    DirectedGraph() : Graph<T, W>() {}
+
+    /*
+     * @brief Constructor de copia de la clase DirectedGraph.
+     * Llama al constructor de copia de la clase base Graph<T, W> y luego copia las aristas.
+     *
+     * @param other El grafo dirigido del cual se creará una copia.
+     */
+    DirectedGraph(const DirectedGraph<T, W>& other) : Graph<T, W>(other) {
+        /* La clase base ya copió los vértices con los mismos índices; solo falta copiar las aristas y su contador. */
+        this->finishCopy(other);
+    }
+
+    /*
+     * @brief Destructor virtual de la clase DirectedGraph.
+     * La liberación de memoria la realiza el destructor de la clase base Graph<T, W>.
+     */
+    virtual ~DirectedGraph() {}
+
+    /*
+     * @brief Agrega un nuevo vértice al grafo dirigido.
+     *
+     * @param data El dato a almacenar en el nuevo vértice.
+     */
+    virtual void addVertex(const T& data) {
+        /* Verifica si el vértice ya existe para evitar duplicados. */
+        if (this->findVertex(data) == NULL) {
+            /* Crea un nuevo nodo de vértice. */
+            VertexNode<T, W>* newNode = this->createVertexNode(data, NULL);
+            /* Si la asignación de memoria falla, no se agrega el vértice. */
+            if (!newNode) return;
+            /* Agrega el nodo al sistema de mapeo de la clase base; si no hay índices disponibles, descarta el nodo. */
+            if (!this->addToMappings(newNode)) {
+                this->destroyVertexNode(newNode);
+                return;
+            }
+            /* Enlaza el nodo al inicio de la lista de vértices. */
+            this->linkVertex(newNode);
+            this->vertexCount++;
+            this->markModified();
+        }
+        /* Si el vértice ya existe, no se hace nada. */
+    }
+
+    /*
+     * @brief Elimina un vértice junto con sus aristas salientes y entrantes.
+     * Cada mitad se elimina con su gemela, por lo que el costo es O(grado de salida + grado de entrada).
+     *
+     * @param data El dato del vértice a eliminar.
+     */
+    virtual void removeVertex(const T& data) {
+        /* Busca el nodo del vértice a eliminar. */
+        VertexNode<T, W>* toRemove = this->findVertex(data);
+        if (toRemove) {
+            int deletedEdges = 0;
+
+            /* 1. Aristas salientes: la mitad entrante gemela vive en la lista de entrada del destino. */
+            AdjacentNode<T, W>* current = toRemove->getNextAdjacent();
+            while (current != NULL) {
+                AdjacentNode<T, W>* next = current->getNext();
+                AdjacentNode<T, W>* twin = current->getTwin();
+                if (twin != NULL) {
+                    unlinkIncoming(current->getData(), twin);
+                    this->destroyAdjacentNode(twin);
+                }
+                this->destroyAdjacentNode(current);
+                deletedEdges++;
+                current = next;
+            }
+            toRemove->setNextAdjacent(NULL);
+
+            /* 2. Aristas entrantes restantes (los lazos ya se eliminaron en el paso anterior). */
+            current = toRemove->getNextIncoming();
+            while (current != NULL) {
+                AdjacentNode<T, W>* next = current->getNext();
+                AdjacentNode<T, W>* twin = current->getTwin();
+                if (twin != NULL) {
+                    this->unlinkAdjacent(current->getData(), twin);
+                    this->destroyAdjacentNode(twin);
+                }
+                this->destroyAdjacentNode(current);
+                deletedEdges++;
+                current = next;
+            }
+            toRemove->setNextIncoming(NULL);
+            this->edgeCount -= deletedEdges;
+
+            /* 3. Desenlaza el vértice y lo elimina del sistema de mapeo. */
+            this->unlinkVertex(toRemove);
+            this->removeFromMappings(data);
+            this->vertexCount--;
+            this->destroyVertexNode(toRemove);
+            this->markModified();
+        }
+    }
+
+    /*
+     * @brief Agrega una arista dirigida desde el origen hacia el destino.
+     *
+     * @param source El dato del vértice de origen.
+     * @param destination El dato del vértice de destino.
+     * @param weight El peso de la arista (por defecto es 1.0).
+     */
+    virtual void addEdge(const T& source, const T& destination, const W& weight = W(1)) {
+        /* Busca los nodos de los vértices de origen y destino. */
+        VertexNode<T, W>* sourceVertex = this->findVertex(source);
+        VertexNode<T, W>* destinationVertex = this->findVertex(destination);
+
+        /* Verifica que ambos vértices existan y que la arista no exista ya. */
+        if (sourceVertex && destinationVertex && !this->findAdjacent(sourceVertex, destination)) {
+            /* Mitad saliente en la lista de adyacencia del origen. */
+            AdjacentNode<T, W>* outgoing = this->createAdjacentNode(destinationVertex, weight);
+            if (!outgoing) return;
+            /* Mitad entrante en la lista de entrada del destino, apunta al origen. */
+            AdjacentNode<T, W>* incoming = this->createAdjacentNode(sourceVertex, weight);
+            if (!incoming) {
+                this->destroyAdjacentNode(outgoing);
+                return;
+            }
+            this->linkAdjacent(sourceVertex, outgoing);
+            linkIncoming(destinationVertex, incoming);
+            outgoing->setTwin(incoming);
+            incoming->setTwin(outgoing);
+            this->edgeCount++;
+            this->markModified();
+        }
+        /* Si la arista ya existe o algún vértice no existe, no se hace nada. */
+    }
+
+    /*
+     * @brief Elimina la arista dirigida desde el origen hacia el destino.
+     *
+     * @param source El dato del vértice de origen.
+     * @param destination El dato del vértice de destino.
+     */
+    virtual void removeEdge(const T& source, const T& destination) {
+        VertexNode<T, W>* sourceVertex = this->findVertex(source);
+        if (sourceVertex) {
+            /* Busca la mitad saliente; la mitad entrante se alcanza por su gemela. */
+            AdjacentNode<T, W>* outgoing = this->findAdjacent(sourceVertex, destination);
+            if (outgoing != NULL) {
+                AdjacentNode<T, W>* incoming = outgoing->getTwin();
+                if (incoming != NULL) {
+                    unlinkIncoming(outgoing->getData(), incoming);
+                    this->destroyAdjacentNode(incoming);
+                }
+                this->unlinkAdjacent(sourceVertex, outgoing);
+                this->destroyAdjacentNode(outgoing);
+                this->edgeCount--;
+                this->markModified();
+            }
+        }
+    }
+
+    /*
+     * @brief Verifica si existe la arista dirigida desde el origen hacia el destino.
+     *
+     * @param source El dato del vértice de origen.
+     * @param destination El dato del vértice de destino.
+     * @return true si existe la arista source -> destination, false en caso contrario.
+     */
+    virtual bool areAdjacent(const T& source, const T& destination) const {
+        VertexNode<T, W>* sourceVertex = this->findVertex(source);
+        return sourceVertex ? this->findAdjacent(sourceVertex, destination) != NULL : false;
+    }
+
+    /*
+     * @brief Devuelve el grado de salida de un vértice, o -1 si no existe.
+     * El grado de la lista de adyacencia se mantiene en el propio vértice, así que cuesta O(1).
+     */
+    int outDegree(const T& data) const {
+        return this->getDegree(data);
+    }
+
+    /*
+     * @brief Devuelve el grado de entrada de un vértice, o -1 si no existe.
+     * Recorre solo la lista de aristas entrantes del vértice.
+     */
+    int inDegree(const T& data) const {
+        VertexNode<T, W>* vertex = this->findVertex(data);
+        return vertex ? countList(vertex->getNextIncoming()) : -1;
+    }
+
+    /*
+     * @brief Devuelve los sucesores de un vértice (destinos de sus aristas salientes).
+     */
+    std::vector<T> getSuccessors(const T& data) const {
+        std::vector<T> result;
+        VertexNode<T, W>* vertex = this->findVertex(data);
+        if (vertex) collectList(vertex->getNextAdjacent(), result);
+        return result;
+    }
+
+    /*
+     * @brief Devuelve los predecesores de un vértice (orígenes de sus aristas entrantes).
+     */
+    std::vector<T> getPredecessors(const T& data) const {
+        std::vector<T> result;
+        VertexNode<T, W>* vertex = this->findVertex(data);
+        if (vertex) collectList(vertex->getNextIncoming(), result);
+        return result;
+    }
+
+protected:
+    /*
+     * @brief Implementación específica para copiar las aristas de otro grafo dirigido a este.
+     * Los vértices ya fueron copiados con los mismos índices. Primero se copian las listas de salida
+     * en orden, agrupando cada mitad saliente copiada por su destino; luego se copian las listas de
+     * entrada en orden, y cada mitad entrante encuentra su gemela en un arreglo indexado por el
+     * origen, lleno con el grupo del vértice. Costo total O(V + E), sin mapas de nodos.
+     *
+     * @param otherGraph El grafo dirigido del cual se copiarán las aristas.
+     * @return false si otherGraph no es dirigido o si falta memoria (la copia queda incompleta).
+     */
+    virtual bool copyEdges(const Graph<T, W>& otherGraph) {
+        /* Realiza un downcast seguro al tipo DirectedGraph. */
+        const DirectedGraph<T, W>* otherDirected = dynamic_cast<const DirectedGraph<T, W>*>(&otherGraph);
+        if (!otherDirected) return false;
+        const std::vector<VertexNode<T, W>*>& otherNodes = otherDirected->indexToNode;
+        int slots = static_cast<int>(otherNodes.size());
+
+        /* 1. Cuenta las mitades salientes que llegan a cada vértice (su grado de entrada). */
+        std::vector<int> groupStart(slots + 1, 0);
+        for (int u = 0; u < slots; u++) {
+            if (otherNodes[u] == NULL) continue;
+            for (AdjacentNode<T, W>* adj = otherNodes[u]->getNextAdjacent(); adj != NULL; adj = adj->getNext()) {
+                groupStart[adj->getData()->getIndex() + 1]++;
+            }
+        }
+        for (int v = 0; v < slots; v++) {
+            groupStart[v + 1] += groupStart[v];
+        }
+        std::vector<int> groupSource(groupStart[slots]);
+        std::vector<AdjacentNode<T, W>*> groupCopy(groupStart[slots]);
+        std::vector<int> groupCursor(groupStart.begin(), groupStart.end() - 1);
+
+        /* 2. Copia las listas de salida en orden. */
+        for (int u = 0; u < slots; u++) {
+            if (otherNodes[u] == NULL) continue;
+            AdjacentNode<T, W>* tail = NULL;
+            for (AdjacentNode<T, W>* adj = otherNodes[u]->getNextAdjacent(); adj != NULL; adj = adj->getNext()) {
+                int v = adj->getData()->getIndex();
+                AdjacentNode<T, W>* outgoing = this->createAdjacentNode(this->indexToNode[v], adj->getWeight());
+                if (!outgoing) return false; /* sin memoria: la copia queda incompleta */
+                this->appendAdjacent(this->indexToNode[u], outgoing, tail);
+                groupSource[groupCursor[v]] = u;
+                groupCopy[groupCursor[v]++] = outgoing;
+            }
+        }
+
+        /* 3. Copia las listas de entrada en orden y empareja cada mitad con su gemela saliente. */
+        std::vector<AdjacentNode<T, W>*> twinOf(slots, NULL);
+        for (int v = 0; v < slots; v++) {
+            if (otherNodes[v] == NULL) continue;
+            for (int k = groupStart[v]; k < groupStart[v + 1]; k++) {
+                twinOf[groupSource[k]] = groupCopy[k];
+            }
+            AdjacentNode<T, W>* tail = NULL;
+            for (AdjacentNode<T, W>* adj = otherNodes[v]->getNextIncoming(); adj != NULL; adj = adj->getNext()) {
+                int u = adj->getData()->getIndex();
+                AdjacentNode<T, W>* incoming = this->createAdjacentNode(this->indexToNode[u], adj->getWeight());
+                if (!incoming) return false;
+                appendIncoming(this->indexToNode[v], incoming, tail);
+                AdjacentNode<T, W>* twin = twinOf[u];
+                if (twin != NULL) {
+                    twin->setTwin(incoming);
+                    incoming->setTwin(twin);
+                }
+            }
+        }
+        /* El contador de aristas lo copia quien invoca este método (finishCopy o copy). */
+        return true;
+    }
+
+    /*
+     * @brief Identifica a los grafos dirigidos en los archivos de instantánea.
+     */
+    virtual unsigned int snapshotKind() const { return SNAPSHOT_DIRECTED; }
+
+    /*
+     * @brief Reconstruye las aristas desde la adyacencia CSR (de salida) de un archivo.
+     * Cada entrada u -> v crea la mitad saliente al final de la lista de u y la entrante al final de la
+     * lista de entrada de v; recorrer los orígenes en orden deja ambas listas ordenadas por índice.
+     *
+     * @param view La adyacencia leída del archivo.
+     * @return false si falta memoria (la restauración queda incompleta).
+     */
+    virtual bool restoreEdges(const CsrView& view) {
+        int slots = view.getVertexSlots();
+        std::vector<AdjacentNode<T, W>*> incomingTails(slots, NULL);
+        for (int u = 0; u < slots; u++) {
+            VertexNode<T, W>* source = this->indexToNode[u];
+            if (source == NULL) continue;
+            AdjacentNode<T, W>* tail = NULL;
+            for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+                int v = view.target(e);
+                AdjacentNode<T, W>* outgoing = this->createAdjacentNode(this->indexToNode[v], W(view.weight(e)));
+                AdjacentNode<T, W>* incoming = this->createAdjacentNode(source, W(view.weight(e)));
+                if (!outgoing || !incoming) {
+                    /* sin memoria: la restauración queda incompleta */
+                    this->destroyAdjacentNode(outgoing);
+                    this->destroyAdjacentNode(incoming);
+                    return false;
+                }
+                this->appendAdjacent(source, outgoing, tail);
+                appendIncoming(this->indexToNode[v], incoming, incomingTails[v]);
+                outgoing->setTwin(incoming);
+                incoming->setTwin(outgoing);
+            }
+        }
+        return true;
+    }
+
+private:
+    /*
+     * @brief Inserta una mitad entrante al inicio de la lista de entrada de un vértice.
+     */
+    void linkIncoming(VertexNode<T, W>* owner, AdjacentNode<T, W>* node) {
+        AdjacentNode<T, W>* head = owner->getNextIncoming();
+        node->setPrev(NULL);
+        node->setNext(head);
+        if (head != NULL) head->setPrev(node);
+        owner->setNextIncoming(node);
+    }
+
+    /*
+     * @brief Agrega una mitad entrante al final de la lista de entrada de un vértice, dado su último nodo.
+     */
+    void appendIncoming(VertexNode<T, W>* owner, AdjacentNode<T, W>* node, AdjacentNode<T, W>*& tail) {
+        node->setNext(NULL);
+        node->setPrev(tail);
+        if (tail == NULL) {
+            owner->setNextIncoming(node);
+        } else {
+            tail->setNext(node);
+        }
+        tail = node;
+    }
+
+    /*
+     * @brief Desenlaza una mitad entrante de la lista de entrada de su vértice en O(1).
+     */
+    void unlinkIncoming(VertexNode<T, W>* owner, AdjacentNode<T, W>* node) {
+        AdjacentNode<T, W>* prev = node->getPrev();
+        AdjacentNode<T, W>* next = node->getNext();
+        if (prev != NULL) {
+            prev->setNext(next);
+        } else {
+            owner->setNextIncoming(next);
+        }
+        if (next != NULL) next->setPrev(prev);
+        node->setPrev(NULL);
+    }
+
+    /*
+     * @brief Cuenta los nodos de una lista de adyacencia.
+     */
+    static int countList(AdjacentNode<T, W>* node) {
+        int count = 0;
+        for (; node != NULL; node = node->getNext()) count++;
+        return count;
+    }
+
+    /*
+     * @brief Agrega a un vector los datos de los vértices referenciados por una lista.
+     */
+    static void collectList(AdjacentNode<T, W>* node, std::vector<T>& result) {
+        for (; node != NULL; node = node->getNext()) result.push_back(node->getData()->getData());
+    }
+};
+
+#endif
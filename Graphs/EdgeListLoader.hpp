@@ -0,0 +1,253 @@
+#ifndef EDGELISTLOADER_H
+#define EDGELISTLOADER_H
+
+#include <cstdio>
+#include <cstddef>
+#include <ctime> /* para clock */
+#include <vector>
+#include <limits> /* para numeric_limits */
+#include "NonDirectedGraph.hpp"
+
+/* estadisticas de una carga de lista de aristas */
+struct EdgeListStats {
+    double bytes; /* bytes leidos del archivo */
+    long lines; /* lineas procesadas (incluye comentarios y lineas vacias) */
+    long parsedEdges; /* aristas leidas correctamente */
+    long addedEdges; /* aristas nuevas agregadas al grafo (sin repetidas ni existentes) */
+    long skippedLines; /* lineas con formato invalido */
+    int chunks; /* bloques leidos del archivo */
+    double seconds; /* tiempo de procesador de la carga completa */
+    double parseSeconds; /* parte del tiempo dedicada a interpretar el texto (el resto es lectura e insercion) */
+
+    EdgeListStats() : bytes(0), lines(0), parsedEdges(0), addedEdges(0), skippedLines(0), chunks(0), seconds(0), parseSeconds(0) {}
+
+    /* rendimiento de la carga completa en megabytes por segundo */
+    double megabytesPerSecond() const {
+        return seconds > 0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0;
+    }
+
+    /* rendimiento del analizador de texto en megabytes por segundo */
+    double parseMegabytesPerSecond() const {
+        return parseSeconds > 0 ? bytes / (1024.0 * 1024.0) / parseSeconds : 0.0;
+    }
+};
+
+/* cargador por bloques de archivos de texto con una arista por linea: "origen destino [peso]"
+lee el archivo en bloques de tamaño fijo con fread, interpreta los numeros con un analizador propio
+(sin iostream ni locale) y agrega cada bloque al grafo con addVertices/addEdges. la memoria usada no
+depende del tamaño del archivo: un bloque de texto y un lote con las aristas de ese bloque.
+los datos de los vertices se leen como enteros, por lo que T debe ser un tipo entero; un identificador fuera
+del rango de T hace invalida la linea.
+las lineas vacias y las que empiezan con '#' o '%' se ignoran; si falta el peso se usa 1.0; lo que
+siga al peso en la misma linea se ignora; una linea mal formada se cuenta y se descarta.
+el peso se lee como double y se convierte a W, el tipo de peso del grafo */
+template <typename T, typename W = double>
+class EdgeListLoader {
+private:
+    std::size_t chunkBytes; /* tamaño del bloque de lectura */
+    EdgeListStats stats; /* estadisticas de la ultima carga */
+    std::vector<typename Graph<T, W>::Edge> batch; /* aristas del bloque actual */
+    std::vector<T> endpoints; /* extremos del bloque actual, para crear los vertices que falten */
+
+    static bool isBlank(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f'; }
+    static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+    static void skipBlanks(const char*& cursor, const char* end) {
+        while (cursor < end && isBlank(*cursor)) cursor++;
+    }
+
+    /* entero con signo opcional; retorna false si no hay digitos o si desborda un long */
+    static bool parseInteger(const char*& cursor, const char* end, long& value) {
+        bool negative = false;
+        if (cursor < end && (*cursor == '-' || *cursor == '+')) {
+            negative = *cursor == '-';
+            cursor++;
+        }
+        if (cursor >= end || !isDigit(*cursor)) return false;
+        /* el valor absoluto admite un digito mas en los negativos: -LONG_MAX - 1 */
+        unsigned long limit = static_cast<unsigned long>(std::numeric_limits<long>::max()) + (negative ? 1UL : 0UL);
+        unsigned long magnitude = 0;
+        while (cursor < end && isDigit(*cursor)) {
+            unsigned long digit = static_cast<unsigned long>(*cursor - '0');
+            if (magnitude > (limit - digit) / 10) return false;
+            magnitude = magnitude * 10 + digit;
+            cursor++;
+        }
+        if (!negative || magnitude == 0) {
+            value = static_cast<long>(magnitude);
+        } else {
+            value = -static_cast<long>(magnitude - 1) - 1;
+        }
+        return true;
+        /* complejidad: o(digitos) */
+    }
+
+    /* verifica que un entero leido sea representable en T; los limites de T se llevan a long solo si caben */
+    static bool fitsVertexType(long value) {
+        if (std::numeric_limits<T>::is_signed) {
+            if (std::numeric_limits<T>::digits >= std::numeric_limits<long>::digits) return true;
+            return value >= static_cast<long>(std::numeric_limits<T>::min()) && value <= static_cast<long>(std::numeric_limits<T>::max());
+        }
+        if (value < 0) return false;
+        if (std::numeric_limits<T>::digits >= std::numeric_limits<unsigned long>::digits) return true;
+        return static_cast<unsigned long>(value) <= static_cast<unsigned long>(std::numeric_limits<T>::max());
+    }
+
+    /* real con signo, parte decimal y exponente opcionales (por ejemplo -1.5e-3) */
+    static bool parseReal(const char*& cursor, const char* end, double& value) {
+        bool negative = false;
+        if (cursor < end && (*cursor == '-' || *cursor == '+')) {
+            negative = *cursor == '-';
+            cursor++;
+        }
+        double mantissa = 0.0;
+        int digits = 0;
+        int exponent = 0;
+        while (cursor < end && isDigit(*cursor)) {
+            mantissa = mantissa * 10.0 + (*cursor - '0');
+            cursor++;
+            digits++;
+        }
+        if (cursor < end && *cursor == '.') {
+            cursor++;
+            while (cursor < end && isDigit(*cursor)) {
+                mantissa = mantissa * 10.0 + (*cursor - '0');
+                exponent--;
+                cursor++;
+                digits++;
+            }
+        }
+        if (digits == 0) return false;
+        if (cursor < end && (*cursor == 'e' || *cursor == 'E')) {
+            cursor++;
+            long written;
+            if (!parseInteger(cursor, end, written) || written > 400 || written < -400) return false;
+            exponent += static_cast<int>(written);
+        }
+        /* aplica el exponente por potencias de diez al cuadrado */
+        double scale = 1.0;
+        double power = 10.0;
+        for (int remaining = exponent < 0 ? -exponent : exponent; remaining > 0; remaining >>= 1) {
+            if (remaining & 1) scale *= power;
+            power *= power;
+        }
+        value = exponent < 0 ? mantissa / scale : mantissa * scale;
+        if (negative) value = -value;
+        return true;
+        /* complejidad: o(digitos) */
+    }
+
+    /* interpreta una linea [begin, end) sin el salto de linea; retorna -1 si es invalida, 0 si no tiene arista, 1 si la tiene */
+    static int parseLine(const char* cursor, const char* end, typename Graph<T, W>::Edge& edge) {
+        skipBlanks(cursor, end);
+        if (cursor == end || *cursor == '#' || *cursor == '%') return 0;
+        long source;
+        long destination;
+        if (!parseInteger(cursor, end, source) || cursor == end || !isBlank(*cursor)) return -1;
+        skipBlanks(cursor, end);
+        if (!parseInteger(cursor, end, destination)) return -1;
+        /* un identificador que cabe en long pero no en T se truncaria y la arista caeria en otro vertice */
+        if (!fitsVertexType(source) || !fitsVertexType(destination)) return -1;
+        edge.source = static_cast<T>(source);
+        edge.destination = static_cast<T>(destination);
+        double weight = 1.0;
+        if (cursor < end && !isBlank(*cursor)) return -1;
+        skipBlanks(cursor, end);
+        if (cursor < end && !parseReal(cursor, end, weight)) return -1;
+        if (cursor < end && !isBlank(*cursor)) return -1;
+        edge.weight = W(weight);
+        return 1;
+        /* complejidad: o(longitud de la linea) */
+    }
+
+    /* interpreta las lineas completas de [begin, end) y las agrega al lote */
+    void parseBlock(const char* begin, const char* end) {
+        typename Graph<T, W>::Edge edge;
+        while (begin < end) {
+            const char* lineEnd = begin;
+            while (lineEnd < end && *lineEnd != '\n') lineEnd++;
+            stats.lines++;
+            int status = parseLine(begin, lineEnd, edge);
+            if (status > 0) {
+                batch.push_back(edge);
+                stats.parsedEdges++;
+            } else if (status < 0) {
+                stats.skippedLines++;
+            }
+            begin = lineEnd + 1;
+        }
+        /* complejidad: o(bytes del bloque) */
+    }
+
+    /* crea los vertices que falten y agrega el lote al grafo */
+    void flush(NonDirectedGraph<T, W>& graph) {
+        endpoints.clear();
+        for (std::size_t i = 0; i < batch.size(); i++) {
+            endpoints.push_back(batch[i].source);
+            endpoints.push_back(batch[i].destination);
+        }
+        graph.addVertices(endpoints.begin(), endpoints.end());
+        stats.addedEdges += graph.addEdges(batch);
+        batch.clear();
+        /* complejidad: o(b log b) con b el tamaño del lote (ver addVertices y addEdges): no depende del tamaño del grafo */
+    }
+
+public:
+    /* chunkBytes es el tamaño del bloque de lectura; una linea mas larga que el bloque lo hace crecer */
+    explicit EdgeListLoader(std::size_t newChunkBytes = 4 << 20) : chunkBytes(newChunkBytes < 64 ? 64 : newChunkBytes) {}
+
+    /* agrega al grafo las aristas del archivo; retorna false si no se pudo abrir o leer completo
+    las aristas de los bloques ya procesados quedan en el grafo aunque la lectura falle despues */
+    bool load(const char* path, NonDirectedGraph<T, W>& graph) {
+        stats = EdgeListStats();
+        std::clock_t start = std::clock();
+        std::FILE* file = std::fopen(path, "rb");
+        if (!file) return false;
+
+        std::vector<char> buffer(chunkBytes);
+        std::size_t carry = 0; /* bytes de una linea incompleta al inicio del buffer */
+        bool ok = true;
+        while (true) {
+            std::size_t read = std::fread(&buffer[carry], 1, buffer.size() - carry, file);
+            std::size_t filled = carry + read;
+            bool finished = filled < buffer.size();
+            if (finished && std::ferror(file)) {
+                ok = false;
+                break;
+            }
+            stats.bytes += static_cast<double>(read);
+            /* solo se interpretan lineas completas: el resto pasa al siguiente bloque */
+            std::size_t cut = filled;
+            if (!finished) {
+                while (cut > 0 && buffer[cut - 1] != '\n') cut--;
+                if (cut == 0) {
+                    /* la linea no entra en el bloque: lo agranda y sigue leyendo */
+                    carry = filled;
+                    buffer.resize(buffer.size() * 2);
+                    continue;
+                }
+            }
+            if (cut > 0) {
+                stats.chunks++;
+                std::clock_t parseStart = std::clock();
+                parseBlock(&buffer[0], &buffer[0] + cut);
+                stats.parseSeconds += static_cast<double>(std::clock() - parseStart) / CLOCKS_PER_SEC;
+                flush(graph);
+            }
+            if (finished) break;
+            carry = filled - cut;
+            for (std::size_t i = 0; i < carry; i++) {
+                buffer[i] = buffer[cut + i];
+            }
+        }
+        std::fclose(file);
+        stats.seconds = static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+        return ok;
+        /* complejidad: o(bytes + aristas log b) con b las aristas de un bloque, con memoria o(chunkBytes + n) */
+    }
+
+    /* estadisticas de la ultima carga */
+    const EdgeListStats& getStats() const { return stats; }
+};
+
+#endif
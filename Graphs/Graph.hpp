@@ -1,378 +1,1053 @@
-#ifndef GRAPH_H
-#define GRAPH_H
-
-#include <cstddef>
-#include <map>
-#include <vector>
-#include <limits> /* para numeric_limits */
-#include "../Node/AdjacentNode.hpp"
-#include "../Node/VertexNode.hpp"
-
-/* clase base abstracta para grafos dirigidos y no dirigidos */
-template <typename T>
-class Graph {
-protected:
-    /* atributos protegidos */
-    VertexNode<T>* firstNode; /* puntero al primer nodo del grafo, no necesariamente ordenado */
-    int vertexCount; /* contador del numero de vertices en el grafo */
-    int edgeCount; /* contador del numero de aristas en el grafo */
-    std::map<T, int> dataToIndex; /* mapeo desde el dato del vertice a su indice interno */
-    std::vector<T> indexToData; /* vector que almacena los datos de los vertices por su indice */
-    int nextIndex; /* entero que indica el siguiente indice disponible para un nuevo vertice */
-
-    /* metodo virtual puro para copiar las aristas del otro grafo a este */
-    virtual void copyEdges(const Graph<T>& otherGraph,
-                             const std::map<VertexNode<T>*, VertexNode<T>*>& nodeMap) = 0;
-
-    /* metodo protegido para agregar un dato al sistema de mapeo de datos a indices */
-    void addToMappings(const T& data) {
-        /* verifica si el dato ya existe en el mapa dataToIndex */
-        if(dataToIndex.find(data) == dataToIndex.end()) {
-            /* seguridad para evitar un overflow del indice */
-            if (nextIndex == std::numeric_limits<int>::max()) {
-                /**/ /* error: se alcanzo el maximo numero de vertices soportados */
-                return;
-            }
-            /* asigna el siguiente indice disponible al dato */
-            dataToIndex[data] = nextIndex;
-            /* agrega el dato al vector indexToData en la posicion del nuevo indice */
-            indexToData.push_back(data);
-            /* incrementa el siguiente indice disponible */
-            nextIndex++;
-        }
-        /* complejidad promedio: o(log n) debido a la busqueda en el mapa */
-        /* complejidad peor caso: o(n) si el mapa degenera a una lista (poco probable con std::map) */
-    }
-
-    /* metodo protegido para eliminar un dato del sistema de mapeo */
-    void removeFromMappings(const T& data) {
-        /* crea un iterador para buscar el dato en el mapa dataToIndex */
-        typename std::map<T, int>::iterator it = dataToIndex.find(data);
-        /* si el iterador es valido (el dato se encontro en el mapa) */
-        if(it != dataToIndex.end()) {
-            /* obtiene el indice asociado al dato */
-            int index = it->second;
-            /* elimina la entrada del dato en el mapa dataToIndex */
-            dataToIndex.erase(it);
-            /* si el indice esta dentro de los limites del vector indexToData, marca esa posicion como "vacia" */
-            if (index >= 0 && index < static_cast<int>(indexToData.size())) {
-                indexToData[index] = T();
-            }
-        }
-        /* complejidad promedio: o(log n) debido a la busqueda y eliminacion en el mapa */
-        /* complejidad peor caso: o(n) si el mapa degenera a una lista */
-    }
-
-    /* metodo protegido para liberar la memoria de todos los nodos del grafo */
-    void clearGraph() {
-        /* comienza con el primer nodo de la lista de vertices */
-        VertexNode<T>* current = firstNode;
-        /* recorre la lista de vertices hasta el final */
-        while(current != NULL) {
-            /* guarda el puntero al siguiente vertice antes de eliminar el actual */
-            VertexNode<T>* next = current->getNextVertex();
-
-            /* comienza con el primer nodo adyacente del vertice actual */
-            AdjacentNode<T>* adj = current->getNextAdjacent();
-            /* recorre la lista de nodos adyacentes del vertice actual */
-            while(adj != NULL) {
-                /* guarda el puntero al siguiente nodo adyacente antes de eliminar el actual */
-                AdjacentNode<T>* nextAdj = adj->getNext();
-                /* elimina el nodo adyacente actual */
-                delete adj;
-                /* avanza al siguiente nodo adyacente */
-                adj = nextAdj;
-            }
-
-            /* elimina el nodo vertice actual */
-            delete current;
-            /* avanza al siguiente nodo vertice */
-            current = next;
-        }
-        /* resetea el puntero al primer nodo */
-        firstNode = NULL;
-        /* resetea el contador de vertices */
-        vertexCount = 0;
-        /* resetea el contador de aristas */
-        edgeCount = 0;
-        /* complejidad promedio: o(n + m) ya que se visitan todos los vertices y todas las aristas en las listas de adyacencia */
-        /* complejidad peor caso: o(n + m) */
-    }
-
-    /* metodo protegido para resetear el sistema de mapeo de datos a indices */
-    void clearMappings() {
-        /* limpia el mapa dataToIndex */
-        dataToIndex.clear();
-        /* limpia el vector indexToData */
-        indexToData.clear();
-        /* resetea el siguiente indice disponible */
-        nextIndex = 0;
-        /* complejidad promedio: o(1) para clear de estructuras de datos estandar */
-        /* complejidad peor caso: o(n) en implementaciones degeneradas */
-    }
-
-    /* metodo protegido para copiar los vertices del otro grafo a este con verificaciones de seguridad */
-    bool copyVerticesFrom(const Graph<T>& otherGraph, std::map<VertexNode<T>*, VertexNode<T>*>& nodeMap) {
-        /* comienza con el primer nodo del grafo original */
-        VertexNode<T>* currentOther = otherGraph.firstNode;
-        /* puntero para mantener el ultimo nodo copiado en el nuevo grafo */
-        VertexNode<T>* lastCopied = NULL;
-        /* contador para el numero de vertices copiados */
-        int copiedCount = 0;
-
-        /* define un limite seguro para evitar posibles bucles infinitos en grafos grandes */
-        const int maxVertices = 1000000; /* un millon de vertices como limite */
-
-        /* recorre todos los vertices del grafo original */
-        while(currentOther != NULL) {
-            /* verifica si se ha alcanzado el limite maximo de vertices */
-            if (copiedCount >= maxVertices) {
-                /**/ /* error: posible bucle infinito o grafo demasiado grande */
-                return false;
-            }
-
-            /* intenta crear un nuevo nodo vertice con los datos del nodo actual del grafo original */
-            VertexNode<T>* newNode = new (std::nothrow) VertexNode<T>(currentOther->getData());
-            /* si la asignacion de memoria falla */
-            if (!newNode) {
-                /**/ /* error: fallo al asignar memoria para nuevo vertice */
-                return false;
-            }
-
-            /* agrega el dato del nuevo nodo al sistema de mapeo */
-            addToMappings(newNode->getData());
-            /* mapea el nodo original al nuevo nodo creado */
-            nodeMap[currentOther] = newNode;
-
-            /* si es el primer nodo que se copia, se establece como el primer nodo del nuevo grafo */
-            if(lastCopied == NULL) {
-                firstNode = newNode;
-            } else {
-                /* enlaza el ultimo nodo copiado con el nuevo nodo */
-                lastCopied->setNextVertex(newNode);
-            }
-
-            /* actualiza el puntero al ultimo nodo copiado */
-            lastCopied = newNode;
-            /* avanza al siguiente nodo en el grafo original */
-            currentOther = currentOther->getNextVertex();
-            /* incrementa el contador de vertices copiados */
-            copiedCount++;
-            /* incrementa el contador total de vertices del nuevo grafo */
-            vertexCount++;
-        }
-        /* la copia de vertices se realizo con exito */
-        return true;
-        /* complejidad promedio: o(n) donde n es el numero de vertices en otherGraph */
-        /* complejidad peor caso: o(n) */
-    }
-
-public:
-    /* constructor vainilla de la clase Grafo */
-    Graph() : firstNode(NULL), vertexCount(0), edgeCount(0), nextIndex(0) {};
-    /* complejidad promedio: o(1) */
-    /* complejidad peor caso: o(1) */
-
-    /* constructor de copia de la clase Grafo */
-/* constructor de copia de la clase Grafo */
-    Graph(const Graph<T>& otherGraph) : firstNode(NULL), vertexCount(0), edgeCount(0), nextIndex(0) {
-        /* si el grafo original esta vacio, no se necesita hacer nada */
-        if(otherGraph.firstNode == NULL) return;
-
-        /* mapa para almacenar la correspondencia entre los nodos del grafo original y los nodos del nuevo grafo */
-        std::map<VertexNode<T>*, VertexNode<T>*> nodeMap;
-        /* copia los vertices del grafo original al nuevo grafo */
-        if (!copyVerticesFrom(otherGraph, nodeMap)) {
-            /* si falla la copia de vertices, libera cualquier memoria alocada y retorna */
-            clear();
-            return;
-        }
-        /* Ahora la copia de aristas se hará en la clase derivada */
-    }
-
-    /* destructor virtual de la clase Grafo para asegurar la correcta liberacion de memoria en las clases derivadas */
-    virtual ~Graph() {
-        /* libera la memoria del grafo al destruirse el objeto */
-        clear();
-        /* complejidad promedio: o(n + m) */
-        /* complejidad peor caso: o(n + m) */
-    }
-
-    /* metodos virtuales puros que deben ser implementados por las clases derivadas */
-    virtual void addVertex(const T& data) = 0;
-    virtual void removeVertex(const T& data) = 0;
-    virtual void addEdge(const T& source, const T& destination, double weight = 1.0) = 0;
-    virtual void removeEdge(const T& source, const T& destination) = 0;
-    virtual bool areAdjacent(const T& source, const T& destination) const = 0;
-
-    /* metodos comunes para obtener informacion del grafo */
-    virtual int getVertexCount() const { return vertexCount; }
-    virtual int getEdgeCount() const { return edgeCount; }
-    virtual bool isEmpty() const { return vertexCount == 0; }
-    /* complejidad promedio: o(1) */
-    /* complejidad peor caso: o(1) */
-
-    /* metodo virtual para liberar toda la memoria del grafo y resetear su estado */
-    virtual void clear() {
-        /* libera la memoria de los nodos del grafo */
-        clearGraph();
-        /* resetea el sistema de mapeo */
-        clearMappings();
-        /* complejidad promedio: o(n + m) */
-        /* complejidad peor caso: o(n + m) */
-    }
-
-    /* metodo virtual para copiar el contenido de otro grafo a este */
-    virtual bool copy(const Graph<T>& otherGraph) {
-        /* evita la autoasignacion */
-        if(this == &otherGraph) return true;
-
-        /* libera la memoria del grafo actual antes de la copia */
-        clear();
-        /* si el grafo original esta vacio, no hay nada que copiar */
-        if(otherGraph.firstNode == NULL) return true;
-
-        /* mapa para almacenar la correspondencia entre los nodos del grafo original y los nodos del nuevo grafo */
-        std::map<VertexNode<T>*, VertexNode<T>*> nodeMap;
-        /* copia los vertices del grafo original */
-        if (!copyVerticesFrom(otherGraph, nodeMap)) {
-            /* si falla la copia de vertices, libera cualquier memoria alocada y retorna false */
-            clear();
-            return false;
-        }
-        /* copia las aristas del grafo original */
-        copyEdges(otherGraph, nodeMap);
-        /* copia el contador de aristas */
-        edgeCount = otherGraph.edgeCount;
-        /* complejidad promedio: o(n + m) */
-        /* complejidad peor caso: o(n^2) */
-        return true;
-    }
-
-    /* operador de asignacion sobrecargado para permitir la asignacion entre objetos Grafo */
-    Graph<T>& operator=(const Graph<T>& otherGraph) {
-        /* evita la autoasignacion */
-        if(this != &otherGraph) {
-            /* utiliza el metodo copy para realizar la copia */
-            copy(otherGraph);
-        }
-        /* devuelve una referencia al objeto actual para permitir el encadenamiento de asignaciones */
-        return *this;
-        /* complejidad promedio: o(n + m) */
-        /* complejidad peor caso: o(n^2) */
-    }
-
-    /* metodos virtuales para verificar la existencia de vertices y aristas */
-    virtual bool containsVertex(const T& data) const {
-        /* utiliza el metodo auxiliar findVertex para buscar el vertice */
-        return findVertex(data) != NULL;
-        /* complejidad promedio: o(n) */
-        /* complejidad peor caso: o(n) */
-    }
-
-    virtual bool containsEdge(const T& source, const T& destination) const {
-        /* busca el nodo vertice de origen */
-        VertexNode<T>* srcVertex = findVertex(source);
-        /* si el vertice de origen existe, busca la arista en su lista de adyacencia */
-        return srcVertex ? findAdjacent(srcVertex, destination) != NULL : false;
-        /* complejidad promedio: o(grado(source)) donde grado es el grado del vertice de origen */
-        /* complejidad peor caso: o(n) si todos los vertices son adyacentes al vertice de origen */
-    }
-
-    virtual double edgeWeight(const T& source, const T& destination) const {
-        /* busca el nodo vertice de origen */
-        VertexNode<T>* srcVertex = findVertex(source);
-        /* si el vertice de origen no existe, retorna un valor indicativo de no encontrado */
-        if(!srcVertex) return -1.0;
-
-        /* busca el nodo adyacente correspondiente al destino */
-        AdjacentNode<T>* adj = findAdjacent(srcVertex, destination);
-        /* si la arista se encuentra, devuelve su peso, sino retorna un valor indicativo de no encontrado */
-        return adj ? adj->getWeight() : -1.0;
-        /* complejidad promedio: o(grado(source)) */
-        /* complejidad peor caso: o(n) */
-    }
-
-    /* metodos virtuales para acceder a los datos del grafo utilizando indices */
-    virtual T getDataByIndex(int index) const {
-        /* verifica si el indice esta dentro de los limites del vector indexToData */
-        return (index >= 0 && index < static_cast<int>(indexToData.size())) ? indexToData[index] : T();
-        /* complejidad promedio: o(1) */
-        /* complejidad peor caso: o(1) */
-    }
-
-    virtual int getIndexByData(const T& data) const {
-        /* busca el dato en el mapa dataToIndex y devuelve su indice si se encuentra */
-        typename std::map<T, int>::const_iterator it = dataToIndex.find(data);
-        return it != dataToIndex.end() ? it->second : -1;
-        /* complejidad promedio: o(log n) */
-        /* complejidad peor caso: o(n) */
-    }
-
-    virtual bool containsVertexByIndex(int index) const {
-        /* verifica si el indice es valido y si hay un dato asociado a ese indice */
-        return (index >= 0 && index < static_cast<int>(indexToData.size()) && !(indexToData[index] == T()));
-        /* complejidad promedio: o(1) */
-        /* complejidad peor caso: o(1) */
-    }
-
-    virtual bool containsEdgeByIndex(int sourceIndex, int destIndex) const {
-        /* verifica si ambos indices corresponden a vertices validos y luego verifica la existencia de la arista por datos */
-        return containsVertexByIndex(sourceIndex) && containsVertexByIndex(destIndex) &&
-               containsEdge(getDataByIndex(sourceIndex), getDataByIndex(destIndex));
-        /* complejidad promedio: o(n) en el peor caso (debido a containsEdge con datos) *//* complejidad peor caso: o(n) */
-    }
-
-    virtual double edgeWeightByIndex(int sourceIndex, int destIndex) const {
-        /* verifica si ambos indices son validos y luego obtiene el peso de la arista por datos */
-        return containsVertexByIndex(sourceIndex) && containsVertexByIndex(destIndex) ?
-               edgeWeight(getDataByIndex(sourceIndex), getDataByIndex(destIndex)) : -1.0;
-        /* complejidad promedio: o(n) en el peor caso */
-        /* complejidad peor caso: o(n) */
-    }
-
-protected:
-    /* metodo protegido para buscar un nodo vertice por su dato */
-    VertexNode<T>* findVertex(const T& data) const {
-        /* comienza la busqueda desde el primer nodo */
-        VertexNode<T>* current = firstNode;
-        /* recorre la lista de vertices hasta encontrar el dato o llegar al final */
-        while (current != NULL) {
-            /* si el dato del nodo actual coincide con el dato buscado, devuelve el nodo */
-            if (current->getData() == data) {
-                return current;
-            }
-            /* avanza al siguiente nodo */
-            current = current->getNextVertex();
-        }
-        /* si el dato no se encuentra, devuelve NULL */
-        return NULL;
-        /* complejidad promedio: o(n) */
-        /* complejidad peor caso: o(n) */
-    }
-
-    /* metodo protegido para buscar un nodo adyacente en la lista de adyacencia de un vertice */
-    AdjacentNode<T>* findAdjacent(VertexNode<T>* vertex, const T& targetData) const {
-        /* si el vertice es NULL o su lista de adyacencia esta vacia, no hay adyacentes */
-        if (!vertex || !vertex->getNextAdjacent()) {
-            return NULL;
-        }
-        /* comienza la busqueda desde el primer nodo adyacente */
-        AdjacentNode<T>* current = vertex->getNextAdjacent();
-        /* recorre la lista de adyacencia hasta encontrar el nodo con el dato destino o llegar al final */
-        while (current != NULL) {
-            /* si el nodo adyacente actual apunta al vertice con el dato destino, devuelve el nodo adyacente */
-            if (current->getData()->getData() == targetData) {
-                return current;
-            }
-            /* avanza al siguiente nodo adyacente */
-            current = current->getNext();
-        }
-        /* si no se encuentra el nodo adyacente, devuelve NULL */
-        return NULL;
-        /* complejidad promedio: o(grado(vertex)) */
-        /* complejidad peor caso: o(n) */
-    }
-};
-
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <cstddef>
+#include <vector>
+#include <algorithm> /* para sort */
+#include <utility> /* para pair */
+#include <limits> /* para numeric_limits */
+#include <climits> /* para CHAR_BIT */
+#include "../Node/AdjacentNode.hpp"
+#include "../Node/VertexNode.hpp"
+#include "../Node/NodePool.hpp"
+#include "../Hash/HashMap.hpp"
+#include "CsrView.hpp"
+#include "GraphSnapshot.hpp"
+
+/* arista expresada con los datos de sus extremos, usada por las operaciones de carga masiva */
+template <typename T, typename W = double>
+struct GraphEdge {
+    T source; /* dato del vertice de origen */
+    T destination; /* dato del vertice de destino */
+    W weight; /* peso de la arista */
+
+    GraphEdge() : source(T()), destination(T()), weight(W(1)) {}
+    GraphEdge(const T& newSource, const T& newDestination, const W& newWeight = W(1))
+        : source(newSource), destination(newDestination), weight(newWeight) {}
+};
+
+/* clase base abstracta para grafos dirigidos y no dirigidos
+W es el tipo del peso de las aristas (ver EdgeWeight.hpp): UnitWeight para grafos sin pesos, que no ocupa
+memoria en los nodos adyacentes, o un tipo aritmetico. las instantaneas csr exponen los pesos como double */
+template <typename T, typename W = double>
+class Graph {
+public:
+    typedef GraphEdge<T, W> Edge; /* tipo de arista para las operaciones de carga masiva */
+
+protected:
+    /* atributos protegidos */
+    VertexNode<T, W>* firstNode; /* puntero al primer nodo del grafo, no necesariamente ordenado */
+    int vertexCount; /* contador del numero de vertices en el grafo */
+    int edgeCount; /* contador del numero de aristas en el grafo */
+    HashMap<T, int> dataToIndex; /* indice hash desde el dato del vertice a su indice interno */
+    std::vector<T> indexToData; /* vector que almacena los datos de los vertices por su indice */
+    std::vector<VertexNode<T, W>*> indexToNode; /* vector que almacena el nodo de cada vertice por su indice */
+    int nextIndex; /* entero que indica el siguiente indice nuevo (nunca usado) para un vertice */
+    std::vector<unsigned long> liveSlots; /* mapa de bits de indices ocupados: un bit apagado es una lapida */
+    std::vector<int> freeIndices; /* pila de indices liberados, se reutilizan antes de crear indices nuevos */
+
+    /* bits por palabra del mapa de bits de indices */
+    static int bitsPerWord() { return static_cast<int>(sizeof(unsigned long) * CHAR_BIT); }
+
+    /* metodos protegidos para consultar y modificar el mapa de bits de indices ocupados */
+    bool isLiveSlot(int index) const {
+        return (liveSlots[index / bitsPerWord()] >> (index % bitsPerWord())) & 1UL;
+    }
+    void setLiveSlot(int index, bool live) {
+        if (live) {
+            liveSlots[index / bitsPerWord()] |= 1UL << (index % bitsPerWord());
+        } else {
+            liveSlots[index / bitsPerWord()] &= ~(1UL << (index % bitsPerWord()));
+        }
+    }
+    unsigned long version; /* contador de modificaciones, cambia con cada mutacion del grafo */
+    CsrView frozenView; /* instantanea csr de la adyacencia, valida solo mientras frozen sea true */
+    bool frozen; /* indica si frozenView corresponde al estado actual del grafo */
+    NodePool<VertexNode<T, W> > vertexPool; /* bloques de memoria para los nodos vertice de este grafo */
+    NodePool<AdjacentNode<T, W> > adjacentPool; /* bloques de memoria para los nodos adyacentes de este grafo */
+    mutable std::vector<unsigned long> pinnedEpochs; /* epoca fijada por cada lector activo (version + 1), 0 si la casilla esta libre */
+    mutable int activeReaders; /* numero de lectores (ReadGuard) activos */
+    std::vector<std::pair<VertexNode<T, W>*, unsigned long> > retiredVertices; /* vertices eliminados a la espera de liberarse, con su epoca */
+    std::vector<std::pair<AdjacentNode<T, W>*, unsigned long> > retiredAdjacents; /* nodos adyacentes eliminados a la espera de liberarse */
+
+    /* metodos protegidos que fijan y liberan la epoca de un lector, retornan y reciben su casilla
+    modifican estado mutable sin sincronizar: ver la NOTA de ReadGuard sobre el uso desde varios hilos */
+    int pinEpoch() const {
+        activeReaders++;
+        for (std::size_t i = 0; i < pinnedEpochs.size(); i++) {
+            if (pinnedEpochs[i] == 0) {
+                pinnedEpochs[i] = version + 1;
+                return static_cast<int>(i);
+            }
+        }
+        pinnedEpochs.push_back(version + 1);
+        return static_cast<int>(pinnedEpochs.size()) - 1;
+        /* complejidad: o(lectores activos) */
+    }
+    void unpinEpoch(int slot) const {
+        pinnedEpochs[slot] = 0;
+        activeReaders--;
+    }
+
+    /* metodos protegidos para crear y destruir nodos con los pools del grafo
+    retornan NULL si no hay memoria, igual que new (std::nothrow) */
+    VertexNode<T, W>* createVertexNode(const T& data, VertexNode<T, W>* nextVertex) {
+        void* memory = vertexPool.allocate();
+        return memory ? new (memory) VertexNode<T, W>(data, nextVertex) : NULL;
+        /* complejidad: o(1) amortizado */
+    }
+
+    /* con lectores activos el nodo no se libera: se retira con la epoca actual y se libera en reclaim */
+    void destroyVertexNode(VertexNode<T, W>* node) {
+        if (activeReaders > 0 && node != NULL) {
+            retiredVertices.push_back(std::make_pair(node, version));
+            return;
+        }
+        vertexPool.destroy(node);
+        /* complejidad: o(1) */
+    }
+
+    AdjacentNode<T, W>* createAdjacentNode(VertexNode<T, W>* target, const W& weight) {
+        void* memory = adjacentPool.allocate();
+        return memory ? new (memory) AdjacentNode<T, W>(target, weight) : NULL;
+        /* complejidad: o(1) amortizado */
+    }
+
+    void destroyAdjacentNode(AdjacentNode<T, W>* node) {
+        if (activeReaders > 0 && node != NULL) {
+            retiredAdjacents.push_back(std::make_pair(node, version));
+            return;
+        }
+        adjacentPool.destroy(node);
+        /* complejidad: o(1) */
+    }
+
+    /* metodo protegido para insertar un vertice al inicio de la lista doblemente enlazada de vertices */
+    void linkVertex(VertexNode<T, W>* node) {
+        node->setPrevVertex(NULL);
+        node->setNextVertex(firstNode);
+        if (firstNode != NULL) firstNode->setPrevVertex(node);
+        firstNode = node;
+        /* complejidad: o(1) */
+    }
+
+    /* metodo protegido para desenlazar un vertice de la lista de vertices sin buscar su predecesor */
+    void unlinkVertex(VertexNode<T, W>* node) {
+        VertexNode<T, W>* prev = node->getPrevVertex();
+        VertexNode<T, W>* next = node->getNextVertex();
+        if (prev != NULL) {
+            prev->setNextVertex(next);
+        } else {
+            firstNode = next;
+        }
+        if (next != NULL) next->setPrevVertex(prev);
+        node->setPrevVertex(NULL);
+        node->setNextVertex(NULL);
+        /* complejidad: o(1) */
+    }
+
+    /* metodo protegido para insertar un nodo adyacente al inicio de la lista de adyacencia de un vertice */
+    void linkAdjacent(VertexNode<T, W>* owner, AdjacentNode<T, W>* node) {
+        AdjacentNode<T, W>* head = owner->getNextAdjacent();
+        node->setPrev(NULL);
+        node->setNext(head);
+        if (head != NULL) head->setPrev(node);
+        owner->setNextAdjacent(node);
+        adjacentAdded(owner, node);
+        /* complejidad: o(1) amortizado */
+    }
+
+    /* metodo protegido para desenlazar un nodo adyacente de la lista de su vertice propietario
+    el nodo conserva su enlace al siguiente: un cursor detenido en el puede seguir avanzando mientras el nodo este retirado */
+    void unlinkAdjacent(VertexNode<T, W>* owner, AdjacentNode<T, W>* node) {
+        AdjacentNode<T, W>* prev = node->getPrev();
+        AdjacentNode<T, W>* next = node->getNext();
+        if (prev != NULL) {
+            prev->setNext(next);
+        } else {
+            owner->setNextAdjacent(next);
+        }
+        if (next != NULL) next->setPrev(prev);
+        node->setPrev(NULL);
+        adjacentRemoved(owner, node);
+        /* complejidad: o(1) promedio */
+    }
+
+    /* grado a partir del cual una lista de adyacencia se acompaña de un indice hash destino -> nodo adyacente;
+    el indice se descarta cuando el grado baja de la mitad del umbral para no reconstruirlo en cada oscilacion */
+    static const int hubDegreeThreshold = 32;
+
+    /* construye el indice hash de adyacencia de un vertice a partir de su lista */
+    void buildAdjacencyIndex(VertexNode<T, W>* owner) {
+        HashMap<VertexNode<T, W>*, AdjacentNode<T, W>*>* index = new (std::nothrow) HashMap<VertexNode<T, W>*, AdjacentNode<T, W>*>();
+        /* sin memoria: el vertice sigue funcionando con busqueda lineal */
+        if (!index) return;
+        index->reserve(static_cast<std::size_t>(owner->getDegree()) * 2);
+        for (AdjacentNode<T, W>* adj = owner->getNextAdjacent(); adj != NULL; adj = adj->getNext()) {
+            /* un lazo aporta dos nodos con el mismo destino: se indexa solo el primero */
+            if (!index->contains(adj->getData())) index->insert(adj->getData(), adj);
+        }
+        owner->setAdjacencyIndex(index);
+        /* complejidad: o(grado(owner)) */
+    }
+
+    /* actualiza el grado y el indice hash de un vertice tras enlazar un nodo adyacente */
+    void adjacentAdded(VertexNode<T, W>* owner, AdjacentNode<T, W>* node) {
+        owner->setDegree(owner->getDegree() + 1);
+        HashMap<VertexNode<T, W>*, AdjacentNode<T, W>*>* index = owner->getAdjacencyIndex();
+        if (index != NULL) {
+            if (!index->contains(node->getData())) index->insert(node->getData(), node);
+        } else if (owner->getDegree() > hubDegreeThreshold) {
+            buildAdjacencyIndex(owner);
+        }
+        /* complejidad: o(1) amortizado */
+    }
+
+    /* actualiza el grado y el indice hash de un vertice tras desenlazar un nodo adyacente */
+    void adjacentRemoved(VertexNode<T, W>* owner, AdjacentNode<T, W>* node) {
+        owner->setDegree(owner->getDegree() - 1);
+        HashMap<VertexNode<T, W>*, AdjacentNode<T, W>*>* index = owner->getAdjacencyIndex();
+        if (index == NULL) return;
+        if (owner->getDegree() < hubDegreeThreshold / 2) {
+            /* el vertice dejo de ser de grado alto: vuelve a la lista simple */
+            owner->setAdjacencyIndex(NULL);
+            return;
+        }
+        AdjacentNode<T, W>** found = index->find(node->getData());
+        if (found != NULL && *found == node) {
+            index->erase(node->getData());
+            /* si era la mitad indexada de un lazo, indexa la mitad que sigue en la lista */
+            if (node->getData() == owner) {
+                for (AdjacentNode<T, W>* adj = owner->getNextAdjacent(); adj != NULL; adj = adj->getNext()) {
+                    if (adj->getData() == owner) {
+                        index->insert(owner, adj);
+                        break;
+                    }
+                }
+            }
+        }
+        /* complejidad: o(1) promedio */
+    }
+
+    /* metodo protegido que registra una mutacion: avanza la version e invalida la instantanea csr */
+    void markModified() {
+        /* sin lectores activos, libera lo que quedo retirado por lectores anteriores */
+        if (activeReaders == 0 && (!retiredVertices.empty() || !retiredAdjacents.empty())) reclaim();
+        version++;
+        if (frozen) {
+            frozenView.release();
+            frozen = false;
+        }
+        /* complejidad: o(1), o(n + m) si hay que liberar una instantanea */
+    }
+
+    /* metodo virtual puro para copiar las aristas del otro grafo a este
+    se invoca despues de copyVerticesFrom, por lo que cada vertice del original se resuelve por su indice en indexToNode
+    retorna false si falta memoria o si el otro grafo es de otro tipo; las aristas quedan incompletas y quien lo invoca
+    debe limpiar el grafo */
+    virtual bool copyEdges(const Graph<T, W>& otherGraph) = 0;
+
+    /* metodo virtual que agrega a row los pares (indice del vecino, peso) de la adyacencia de un indice ocupado
+    lo usa freeze; las clases derivadas que no guardan la adyacencia en listas lo sobrescriben */
+    virtual void collectRow(int index, std::vector<std::pair<int, double> >& row) const {
+        for (AdjacentNode<T, W>* adj = indexToNode[index]->getNextAdjacent(); adj != NULL; adj = adj->getNext()) {
+            row.push_back(std::make_pair(adj->getData()->getIndex(), static_cast<double>(adj->getWeight())));
+        }
+        /* complejidad: o(grado(index)) */
+    }
+
+    /* metodo virtual puro que identifica el tipo de grafo en los archivos de instantanea (SnapshotKind) */
+    virtual unsigned int snapshotKind() const = 0;
+
+    /* metodo virtual puro para reconstruir las aristas desde la adyacencia csr de un archivo
+    se invoca despues de restoreVerticesFrom, con los vertices ya ubicados en los indices de la instantanea
+    retorna false si falta memoria; las aristas quedan incompletas y quien lo invoca debe limpiar el grafo */
+    virtual bool restoreEdges(const CsrView& view) = 0;
+
+    /* metodo virtual que se invoca cuando compactIndices renumera los vertices (oldToNew traduce cada indice anterior)
+    las listas de adyacencia apuntan a nodos y no necesitan cambios; las estructuras indexadas por indice deben remapearse */
+    virtual void indicesRenumbered(const std::vector<int>& oldToNew) {
+        (void)oldToNew;
+    }
+
+    /* metodo protegido para agregar el dato de un nodo al sistema de mapeo de datos a indices
+    retorna false si el dato ya estaba registrado o si no quedan indices disponibles */
+    bool addToMappings(VertexNode<T, W>* node) {
+        /* verifica si el dato ya existe en el indice dataToIndex */
+        if(dataToIndex.contains(node->getData())) return false;
+        int index;
+        if (!freeIndices.empty()) {
+            /* reutiliza el ultimo indice liberado */
+            index = freeIndices.back();
+            freeIndices.pop_back();
+            indexToData[index] = node->getData();
+            indexToNode[index] = node;
+        } else {
+            /* seguridad para evitar un overflow del indice */
+            if (nextIndex == std::numeric_limits<int>::max()) {
+                /**/ /* error: se alcanzo el maximo numero de vertices soportados */
+                return false;
+            }
+            /* agrega el dato y el nodo a los vectores en la posicion del nuevo indice */
+            index = nextIndex++;
+            indexToData.push_back(node->getData());
+            indexToNode.push_back(node);
+            if (index % bitsPerWord() == 0) liveSlots.push_back(0UL);
+        }
+        /* asigna el indice al dato y al nodo, y marca la casilla como ocupada */
+        dataToIndex.insert(node->getData(), index);
+        node->setIndex(index);
+        setLiveSlot(index, true);
+        return true;
+        /* complejidad promedio: o(1) amortizado debido al indice hash */
+        /* complejidad peor caso: o(n) si todas las claves colisionan */
+    }
+
+    /* metodo protegido para eliminar un dato del sistema de mapeo */
+    void removeFromMappings(const T& data) {
+        /* busca el dato en el indice dataToIndex */
+        const int* found = dataToIndex.find(data);
+        /* si el dato se encontro en el indice */
+        if(found != NULL) {
+            /* obtiene el indice asociado al dato */
+            int index = *found;
+            /* elimina la entrada del dato en el indice dataToIndex */
+            dataToIndex.erase(data);
+            /* si el indice esta dentro de los limites, deja una lapida en su casilla y lo guarda para reutilizarlo */
+            if (index >= 0 && index < static_cast<int>(indexToData.size())) {
+                indexToData[index] = T();
+                indexToNode[index] = NULL;
+                setLiveSlot(index, false);
+                freeIndices.push_back(index);
+            }
+        }
+        /* complejidad promedio: o(1) debido al indice hash */
+        /* complejidad peor caso: o(n) si todas las claves colisionan */
+    }
+
+    /* metodo protegido para liberar la memoria de todos los nodos del grafo */
+    void clearGraph() {
+        /* los vertices retirados aun no ejecutaron su destructor; los nodos adyacentes retirados se liberan con el pool.
+        las listas de retirados quedan vacias antes de releaseAll para que reclaim no toque memoria ya devuelta */
+        for (std::size_t i = 0; i < retiredVertices.size(); i++) {
+            vertexPool.destroy(retiredVertices[i].first);
+        }
+        retiredVertices.clear();
+        retiredAdjacents.clear();
+        /* comienza con el primer nodo de la lista de vertices */
+        VertexNode<T, W>* current = firstNode;
+        /* recorre la lista de vertices hasta el final: los vertices se destruyen uno a uno porque su dato puede administrar memoria.
+        se destruyen directamente, sin retirarlos aunque haya lectores: releaseAll libera los bloques de todas formas,
+        por eso clear invalida los cursores abiertos (ver ReadGuard) */
+        while(current != NULL) {
+            /* guarda el puntero al siguiente vertice antes de eliminar el actual */
+            VertexNode<T, W>* next = current->getNextVertex();
+            /* elimina el nodo vertice actual */
+            vertexPool.destroy(current);
+            /* avanza al siguiente nodo vertice */
+            current = next;
+        }
+        /* los nodos adyacentes solo guardan punteros y un peso: se liberan en bloque sin recorrer las aristas */
+        adjacentPool.releaseAll();
+        vertexPool.releaseAll();
+        /* resetea el puntero al primer nodo */
+        firstNode = NULL;
+        /* resetea el contador de vertices */
+        vertexCount = 0;
+        /* resetea el contador de aristas */
+        edgeCount = 0;
+        /* complejidad promedio: o(n + b) donde b es el numero de bloques de los pools; las aristas no se visitan */
+        /* complejidad peor caso: o(n + b) */
+    }
+
+    /* metodo protegido para resetear el sistema de mapeo de datos a indices */
+    void clearMappings() {
+        /* limpia el indice hash dataToIndex */
+        dataToIndex.clear();
+        /* limpia los vectores indexToData e indexToNode */
+        indexToData.clear();
+        indexToNode.clear();
+        /* limpia el mapa de bits y la pila de indices libres */
+        liveSlots.clear();
+        freeIndices.clear();
+        /* resetea el siguiente indice disponible */
+        nextIndex = 0;
+        /* complejidad promedio: o(1) para clear de estructuras de datos estandar */
+        /* complejidad peor caso: o(n) en implementaciones degeneradas */
+    }
+
+    /* metodo protegido para copiar los vertices del otro grafo a este conservando sus indices internos
+    la tabla de indices se copia tal cual, asi las aristas se pueden copiar despues resolviendo cada vertice
+    por indice (sin mapas de nodos) y los indices del grafo copiado coinciden con los del original */
+    bool copyVerticesFrom(const Graph<T, W>& otherGraph) {
+        /* copia el sistema de mapeo completo */
+        dataToIndex = otherGraph.dataToIndex;
+        indexToData = otherGraph.indexToData;
+        nextIndex = otherGraph.nextIndex;
+        liveSlots = otherGraph.liveSlots;
+        freeIndices = otherGraph.freeIndices;
+        indexToNode.assign(otherGraph.indexToNode.size(), NULL);
+
+        /* crea un nodo por cada indice ocupado del original */
+        for (std::size_t i = 0; i < otherGraph.indexToNode.size(); i++) {
+            if (otherGraph.indexToNode[i] == NULL) continue;
+            VertexNode<T, W>* newNode = createVertexNode(otherGraph.indexToNode[i]->getData(), NULL);
+            /* si la asignacion de memoria falla */
+            if (!newNode) {
+                /**/ /* error: fallo al asignar memoria para nuevo vertice */
+                /* destruye los nodos creados hasta ahora, todavia no estan enlazados en la lista */
+                for (std::size_t k = 0; k < i; k++) {
+                    destroyVertexNode(indexToNode[k]);
+                    indexToNode[k] = NULL;
+                }
+                return false;
+            }
+            newNode->setIndex(static_cast<int>(i));
+            indexToNode[i] = newNode;
+        }
+
+        /* enlaza los nodos en el mismo orden que la lista de vertices del original */
+        VertexNode<T, W>* lastCopied = NULL;
+        int copiedCount = 0;
+        /* el recorrido se limita al numero de vertices del original como proteccion contra listas corruptas */
+        for (VertexNode<T, W>* currentOther = otherGraph.firstNode;
+             currentOther != NULL && copiedCount < otherGraph.vertexCount;
+             currentOther = currentOther->getNextVertex()) {
+            VertexNode<T, W>* newNode = indexToNode[currentOther->getIndex()];
+            /* si es el primer nodo que se copia, se establece como el primer nodo del nuevo grafo */
+            if(lastCopied == NULL) {
+                firstNode = newNode;
+            } else {
+                /* enlaza el ultimo nodo copiado con el nuevo nodo en ambos sentidos */
+                lastCopied->setNextVertex(newNode);
+                newNode->setPrevVertex(lastCopied);
+            }
+            /* actualiza el puntero al ultimo nodo copiado */
+            lastCopied = newNode;
+            copiedCount++;
+        }
+        vertexCount = copiedCount;
+        /* la copia de vertices se realizo con exito */
+        return true;
+        /* complejidad promedio: o(n) donde n es el numero de indices de otherGraph */
+        /* complejidad peor caso: o(n) */
+    }
+
+    /* metodo protegido para crear los vertices de una instantanea en sus mismos indices
+    los vertices quedan enlazados en orden de indice; las casillas libres pasan a la pila de indices libres
+    retorna false si falta memoria o si la tabla trae datos repetidos (load los descarta antes de llamarlo) */
+    bool restoreVerticesFrom(const std::vector<T>& data, const std::vector<unsigned char>& live) {
+        int slots = static_cast<int>(data.size());
+        indexToData.assign(slots, T());
+        indexToNode.assign(slots, NULL);
+        liveSlots.assign((slots + bitsPerWord() - 1) / bitsPerWord(), 0UL);
+        freeIndices.clear();
+        nextIndex = slots;
+        VertexNode<T, W>* last = NULL;
+        for (int i = slots - 1; i >= 0; i--) {
+            if (!live[i]) freeIndices.push_back(i);
+        }
+        for (int i = 0; i < slots; i++) {
+            if (!live[i]) continue;
+            VertexNode<T, W>* newNode = createVertexNode(data[i], NULL);
+            if (!newNode) return false;
+            /* enlaza primero el nodo para que clear lo libere si la restauracion falla mas adelante */
+            if (last == NULL) {
+                firstNode = newNode;
+            } else {
+                last->setNextVertex(newNode);
+                newNode->setPrevVertex(last);
+            }
+            last = newNode;
+            vertexCount++;
+            if (!dataToIndex.insert(data[i], i)) return false;
+            newNode->setIndex(i);
+            indexToData[i] = data[i];
+            indexToNode[i] = newNode;
+            setLiveSlot(i, true);
+        }
+        return true;
+        /* complejidad promedio: o(n) */
+    }
+
+    /* metodo protegido para agregar un nodo adyacente al final de una lista, dado su ultimo nodo (tail)
+    se usa al copiar para conservar el orden de las listas de adyacencia */
+    void appendAdjacent(VertexNode<T, W>* owner, AdjacentNode<T, W>* node, AdjacentNode<T, W>*& tail) {
+        node->setNext(NULL);
+        node->setPrev(tail);
+        if (tail == NULL) {
+            owner->setNextAdjacent(node);
+        } else {
+            tail->setNext(node);
+        }
+        tail = node;
+        adjacentAdded(owner, node);
+        /* complejidad: o(1) amortizado */
+    }
+
+public:
+    /* constructor vainilla de la clase Grafo */
+    Graph() : firstNode(NULL), vertexCount(0), edgeCount(0), nextIndex(0), version(0), frozen(false), activeReaders(0) {};
+    /* complejidad promedio: o(1) */
+    /* complejidad peor caso: o(1) */
+
+    /* constructor de copia de la clase Grafo */
+    Graph(const Graph<T, W>& otherGraph) : firstNode(NULL), vertexCount(0), edgeCount(0), nextIndex(0), version(0), frozen(false), activeReaders(0) {
+        /* si el grafo original esta vacio, no se necesita hacer nada */
+        if(otherGraph.firstNode == NULL) return;
+
+        /* copia los vertices del grafo original al nuevo grafo conservando sus indices */
+        if (!copyVerticesFrom(otherGraph)) {
+            /* si falla la copia de vertices, libera cualquier memoria alocada y retorna */
+            clear();
+            return;
+        }
+        /* Ahora la copia de aristas se hará en la clase derivada, con finishCopy */
+    }
+
+    /* metodo protegido que completan los constructores de copia de las clases derivadas: copia las aristas solo si la
+    copia de vertices de la clase base tuvo exito, y el contador de aristas solo si las aristas quedaron completas;
+    si algo falla deja el grafo vacio, igual que copy */
+    void finishCopy(const Graph<T, W>& otherGraph) {
+        if (vertexCount != otherGraph.vertexCount || !copyEdges(otherGraph)) {
+            clear();
+            return;
+        }
+        edgeCount = otherGraph.edgeCount;
+        /* complejidad: o(n + m) */
+    }
+
+    /* destructor virtual de la clase Grafo para asegurar la correcta liberacion de memoria en las clases derivadas */
+    virtual ~Graph() {
+        /* libera la memoria del grafo al destruirse el objeto */
+        clear();
+        /* complejidad promedio: o(n + m) */
+        /* complejidad peor caso: o(n + m) */
+    }
+
+    /* metodos virtuales puros que deben ser implementados por las clases derivadas */
+    virtual void addVertex(const T& data) = 0;
+    virtual void removeVertex(const T& data) = 0;
+    virtual void addEdge(const T& source, const T& destination, const W& weight = W(1)) = 0;
+    virtual void removeEdge(const T& source, const T& destination) = 0;
+    virtual bool areAdjacent(const T& source, const T& destination) const = 0;
+
+    /* reserva espacio en el sistema de mapeo para un numero total de vertices y evita redimensionamientos */
+    void reserveVertices(int count) {
+        if (count <= 0) return;
+        dataToIndex.reserve(static_cast<std::size_t>(count));
+        indexToData.reserve(static_cast<std::size_t>(count));
+        indexToNode.reserve(static_cast<std::size_t>(count));
+        /* complejidad: o(count) */
+    }
+
+    /* estadisticas de memoria: nodos solicitados (una llamada a new por nodo sin pools) frente a bloques reservados */
+    unsigned long getNodeRequestCount() const { return vertexPool.getRequestCount() + adjacentPool.getRequestCount(); }
+    int getSlabCount() const { return vertexPool.getSlabCount() + adjacentPool.getSlabCount(); }
+    /* bytes de los nodos adyacentes en uso (dos por arista no dirigida); depende del tipo de peso W */
+    std::size_t getAdjacencyBytes() const {
+        return static_cast<std::size_t>(adjacentPool.getLiveCount()) * sizeof(AdjacentNode<T, W>);
+    }
+
+    /* devuelve el numero de entradas en la lista de adyacencia de un vertice, o -1 si no existe */
+    int getDegree(const T& data) const {
+        VertexNode<T, W>* vertex = findVertex(data);
+        return vertex ? vertex->getDegree() : -1;
+        /* complejidad promedio: o(1) */
+    }
+
+    /* metodos comunes para obtener informacion del grafo */
+    virtual int getVertexCount() const { return vertexCount; }
+    virtual int getEdgeCount() const { return edgeCount; }
+    virtual bool isEmpty() const { return vertexCount == 0; }
+    /* complejidad promedio: o(1) */
+    /* complejidad peor caso: o(1) */
+
+    /* metodo virtual para liberar toda la memoria del grafo y resetear su estado */
+    virtual void clear() {
+        /* libera la memoria de los nodos del grafo */
+        clearGraph();
+        /* resetea el sistema de mapeo */
+        clearMappings();
+        /* registra la mutacion e invalida la instantanea */
+        markModified();
+        /* complejidad promedio: o(n + m) */
+        /* complejidad peor caso: o(n + m) */
+    }
+
+    /* metodo virtual para copiar el contenido de otro grafo a este */
+    virtual bool copy(const Graph<T, W>& otherGraph) {
+        /* evita la autoasignacion */
+        if(this == &otherGraph) return true;
+
+        /* libera la memoria del grafo actual antes de la copia */
+        clear();
+        /* si el grafo original esta vacio, no hay nada que copiar */
+        if(otherGraph.firstNode == NULL) return true;
+
+        /* copia los vertices del grafo original conservando sus indices */
+        if (!copyVerticesFrom(otherGraph)) {
+            /* si falla la copia de vertices, libera cualquier memoria alocada y retorna false */
+            clear();
+            return false;
+        }
+        /* copia las aristas del grafo original; si falla, no deja una copia a medias */
+        if (!copyEdges(otherGraph)) {
+            clear();
+            return false;
+        }
+        /* copia el contador de aristas */
+        edgeCount = otherGraph.edgeCount;
+        /* registra la mutacion */
+        markModified();
+        /* complejidad promedio: o(n + m) */
+        /* complejidad peor caso: o(n + m) */
+        return true;
+    }
+
+    /* operador de asignacion sobrecargado para permitir la asignacion entre objetos Grafo */
+    Graph<T, W>& operator=(const Graph<T, W>& otherGraph) {
+        /* evita la autoasignacion */
+        if(this != &otherGraph) {
+            /* utiliza el metodo copy para realizar la copia */
+            copy(otherGraph);
+        }
+        /* devuelve una referencia al objeto actual para permitir el encadenamiento de asignaciones */
+        return *this;
+        /* complejidad promedio: o(n + m) */
+        /* complejidad peor caso: o(n + m) */
+    }
+
+    /* metodos virtuales para verificar la existencia de vertices y aristas */
+    virtual bool containsVertex(const T& data) const {
+        /* utiliza el metodo auxiliar findVertex para buscar el vertice */
+        return findVertex(data) != NULL;
+        /* complejidad promedio: o(1) */
+        /* complejidad peor caso: o(n) */
+    }
+
+    virtual bool containsEdge(const T& source, const T& destination) const {
+        /* busca el nodo vertice de origen */
+        VertexNode<T, W>* srcVertex = findVertex(source);
+        /* si el vertice de origen existe, busca la arista en su lista de adyacencia */
+        return srcVertex ? findAdjacent(srcVertex, destination) != NULL : false;
+        /* complejidad promedio: o(grado(source)) donde grado es el grado del vertice de origen */
+        /* complejidad peor caso: o(n) si todos los vertices son adyacentes al vertice de origen */
+    }
+
+    virtual double edgeWeight(const T& source, const T& destination) const {
+        /* busca el nodo vertice de origen */
+        VertexNode<T, W>* srcVertex = findVertex(source);
+        /* si el vertice de origen no existe, retorna un valor indicativo de no encontrado */
+        if(!srcVertex) return -1.0;
+
+        /* busca el nodo adyacente correspondiente al destino */
+        AdjacentNode<T, W>* adj = findAdjacent(srcVertex, destination);
+        /* si la arista se encuentra, devuelve su peso, sino retorna un valor indicativo de no encontrado */
+        return adj ? static_cast<double>(adj->getWeight()) : -1.0;
+        /* complejidad promedio: o(grado(source)) */
+        /* complejidad peor caso: o(n) */
+    }
+
+    /* peso de una arista con su tipo W; a diferencia de edgeWeight, la ausencia de la arista se indica con
+    found() y no con un valor especial, asi que sirve tambien para pesos negativos o tipos sin -1 */
+    virtual OptionalWeight<W> findEdgeWeight(const T& source, const T& destination) const {
+        VertexNode<T, W>* srcVertex = findVertex(source);
+        AdjacentNode<T, W>* adj = srcVertex ? findAdjacent(srcVertex, destination) : NULL;
+        return adj ? OptionalWeight<W>(adj->getWeight()) : OptionalWeight<W>();
+        /* complejidad promedio: o(1) en vertices con indice hash, o(grado(source)) en los demas */
+    }
+
+    /* metodos virtuales para acceder a los datos del grafo utilizando indices */
+    virtual T getDataByIndex(int index) const {
+        /* verifica si el indice corresponde a una casilla ocupada */
+        return containsVertexByIndex(index) ? indexToData[index] : T();
+        /* complejidad promedio: o(1) */
+        /* complejidad peor caso: o(1) */
+    }
+
+    virtual int getIndexByData(const T& data) const {
+        /* busca el dato en el indice dataToIndex y devuelve su indice si se encuentra */
+        const int* found = dataToIndex.find(data);
+        return found != NULL ? *found : -1;
+        /* complejidad promedio: o(1) */
+        /* complejidad peor caso: o(n) */
+    }
+
+    virtual bool containsVertexByIndex(int index) const {
+        /* verifica si el indice es valido y si su casilla esta ocupada (no depende del valor del dato) */
+        return index >= 0 && index < static_cast<int>(indexToNode.size()) && isLiveSlot(index);
+        /* complejidad promedio: o(1) */
+        /* complejidad peor caso: o(1) */
+    }
+
+    virtual bool containsEdgeByIndex(int sourceIndex, int destIndex) const {
+        /* si el grafo esta congelado, resuelve la arista con una busqueda binaria sobre la instantanea */
+        if (frozen) {
+            return containsVertexByIndex(sourceIndex) && frozenView.containsEdge(sourceIndex, destIndex);
+        }
+        /* va directo a la casilla del origen y busca el destino por indice, sin pasar por los datos */
+        return containsVertexByIndex(sourceIndex) && containsVertexByIndex(destIndex) &&
+               findAdjacentByIndex(indexToNode[sourceIndex], destIndex) != NULL;
+        /* complejidad promedio: o(grado(source)) */
+        /* complejidad peor caso: o(n) */
+    }
+
+    virtual double edgeWeightByIndex(int sourceIndex, int destIndex) const {
+        /* si el grafo esta congelado, obtiene el peso desde la instantanea */
+        if (frozen) {
+            return containsVertexByIndex(sourceIndex) ? frozenView.edgeWeight(sourceIndex, destIndex) : -1.0;
+        }
+        /* va directo a la casilla del origen y busca el destino por indice */
+        if (!containsVertexByIndex(sourceIndex) || !containsVertexByIndex(destIndex)) return -1.0;
+        AdjacentNode<T, W>* adj = findAdjacentByIndex(indexToNode[sourceIndex], destIndex);
+        return adj ? static_cast<double>(adj->getWeight()) : -1.0;
+        /* complejidad promedio: o(grado(source)) */
+        /* complejidad peor caso: o(n) */
+    }
+
+    /* numero de casillas de la tabla de indices (ocupadas y libres): los indices validos estan en [0, getIndexCapacity()) */
+    int getIndexCapacity() const { return static_cast<int>(indexToNode.size()); }
+
+    /* numero de indices libres a la espera de ser reutilizados */
+    int getFreeIndexCount() const { return static_cast<int>(freeIndices.size()); }
+
+    /* renumera los vertices de forma densa (0..n-1) conservando el orden relativo de sus indices
+    retorna un vector que traduce cada indice anterior a su indice nuevo (-1 para las lapidas) */
+    std::vector<int> compactIndices() {
+        int slots = static_cast<int>(indexToNode.size());
+        std::vector<int> oldToNew(slots, -1);
+        int next = 0;
+        for (int i = 0; i < slots; i++) {
+            if (!isLiveSlot(i)) continue;
+            oldToNew[i] = next;
+            /* mueve la casilla a su nueva posicion (next <= i, asi que no pisa casillas pendientes) */
+            indexToData[next] = indexToData[i];
+            indexToNode[next] = indexToNode[i];
+            indexToNode[next]->setIndex(next);
+            dataToIndex.insert(indexToData[next], next);
+            next++;
+        }
+        indexToData.resize(next);
+        indexToNode.resize(next);
+        /* reconstruye el mapa de bits: todas las casillas quedan ocupadas */
+        liveSlots.assign((next + bitsPerWord() - 1) / bitsPerWord(), 0UL);
+        for (int i = 0; i < next; i++) {
+            setLiveSlot(i, true);
+        }
+        freeIndices.clear();
+        nextIndex = next;
+        /* avisa a la clase derivada para que remapee sus estructuras indexadas */
+        indicesRenumbered(oldToNew);
+        /* los indices cambiaron: la instantanea csr deja de ser valida */
+        markModified();
+        return oldToNew;
+        /* complejidad promedio: o(n) */
+        /* complejidad peor caso: o(n) */
+    }
+
+    /* renumera los vertices segun order (los indices actuales de los vertices, en su orden nuevo) y reconstruye
+    el almacenamiento en ese orden: los nodos vertice se crean y enlazan en orden de indice y los nodos adyacentes
+    fila por fila, cada lista ordenada por el indice del vecino, asi que recorrer el grafo en orden de indice lee
+    memoria casi contigua. los indices quedan densos (0..n-1) y la adyacencia renumerada queda como instantanea
+    csr vigente. retorna un vector que traduce cada indice anterior a su indice nuevo (-1 para las lapidas), o un
+    vector vacio sin modificar el grafo si order no es una permutacion de los indices ocupados (si falta memoria
+    durante la reconstruccion el grafo queda vacio y tambien se retorna un vector vacio)
+    NOTA: igual que clear y load, invalida los cursores abiertos */
+    std::vector<int> renumber(const std::vector<int>& order) {
+        int slots = static_cast<int>(indexToNode.size());
+        std::vector<int> oldToNew(slots, -1);
+        if (static_cast<int>(order.size()) != vertexCount) return std::vector<int>();
+        for (int r = 0; r < vertexCount; r++) {
+            int old = order[r];
+            if (!containsVertexByIndex(old) || oldToNew[old] >= 0) return std::vector<int>();
+            oldToNew[old] = r;
+        }
+
+        /* instantanea renumerada: las filas se reordenan y cada fila se vuelve a ordenar por el indice nuevo */
+        const CsrView& view = freeze();
+        std::vector<int> offsets(vertexCount + 1, 0);
+        for (int r = 0; r < vertexCount; r++) {
+            offsets[r + 1] = offsets[r] + view.degree(order[r]);
+        }
+        std::vector<int> neighbors(offsets[vertexCount]);
+        std::vector<double> weights(offsets[vertexCount]);
+        std::vector<std::pair<int, double> > row;
+        for (int r = 0; r < vertexCount; r++) {
+            row.clear();
+            for (int e = view.edgeBegin(order[r]); e < view.edgeEnd(order[r]); e++) {
+                row.push_back(std::make_pair(oldToNew[view.target(e)], view.weight(e)));
+            }
+            std::sort(row.begin(), row.end());
+            for (std::size_t k = 0; k < row.size(); k++) {
+                neighbors[offsets[r] + k] = row[k].first;
+                weights[offsets[r] + k] = row[k].second;
+            }
+        }
+        CsrView renumbered;
+        renumbered.adopt(offsets, neighbors, weights, 0);
+        std::vector<T> data(vertexCount);
+        for (int r = 0; r < vertexCount; r++) {
+            data[r] = indexToData[order[r]];
+        }
+        std::vector<unsigned char> live(vertexCount, 1);
+
+        /* reconstruye el grafo desde la instantanea renumerada, igual que load */
+        int edges = edgeCount;
+        clear();
+        if (!restoreVerticesFrom(data, live)) {
+            /**/ /* error: fallo al asignar memoria durante la reconstruccion */
+            clear();
+            return std::vector<int>();
+        }
+        if (!restoreEdges(renumbered)) {
+            /**/ /* error: fallo al asignar memoria durante la reconstruccion */
+            clear();
+            return std::vector<int>();
+        }
+        edgeCount = edges;
+        markModified();
+        frozenView.adopt(renumbered, version);
+        frozen = true;
+        return oldToNew;
+        /* complejidad: o(n + m log d) con d el grado maximo */
+    }
+
+    /* congela la adyacencia actual en una instantanea csr contigua indexada por los indices internos
+    la instantanea se reutiliza mientras el grafo no cambie y se descarta con la siguiente mutacion */
+    const CsrView& freeze() {
+        /* si la instantanea sigue vigente, no hay nada que reconstruir */
+        if (frozen) return frozenView;
+
+        int slots = static_cast<int>(indexToNode.size());
+        /* primera pasada: toma el grado de cada indice, que cada vertice mantiene al dia */
+        std::vector<int> offsets(slots + 1, 0);
+        for (int i = 0; i < slots; i++) {
+            if (indexToNode[i] == NULL) continue; /* indice de un vertice eliminado: fila vacia */
+            offsets[i + 1] = indexToNode[i]->getDegree();
+        }
+        /* suma prefija para obtener el inicio de cada fila */
+        for (int i = 0; i < slots; i++) {
+            offsets[i + 1] += offsets[i];
+        }
+
+        /* segunda pasada: copia cada fila y la ordena por indice de vecino */
+        std::vector<int> neighbors(offsets[slots]);
+        std::vector<double> weights(offsets[slots]);
+        std::vector<std::pair<int, double> > row;
+        for (int i = 0; i < slots; i++) {
+            if (indexToNode[i] == NULL) continue;
+            row.clear();
+            collectRow(i, row);
+            std::sort(row.begin(), row.end());
+            for (std::size_t k = 0; k < row.size(); k++) {
+                neighbors[offsets[i] + k] = row[k].first;
+                weights[offsets[i] + k] = row[k].second;
+            }
+        }
+
+        /* publica la instantanea */
+        frozenView.adopt(offsets, neighbors, weights, version);
+        frozen = true;
+        return frozenView;
+        /* complejidad promedio: o(n + m log d) donde d es el grado maximo */
+        /* complejidad peor caso: o(n + m log d) */
+    }
+
+    /* descarta la instantanea csr y libera su memoria */
+    void thaw() {
+        if (frozen) {
+            frozenView.release();
+            frozen = false;
+        }
+    }
+
+    /* indica si existe una instantanea csr vigente */
+    bool isFrozen() const { return frozen; }
+
+    /* devuelve la version actual del grafo */
+    unsigned long getVersion() const { return version; }
+
+    /* lector protegido: mientras exista, los nodos que eliminen las escrituras no se liberan (se retiran con la
+    epoca de la eliminacion) y los nodos desenlazados conservan su enlace al siguiente, asi que un NeighborCursor
+    abierto bajo la guarda sigue siendo valido y puede terminar su recorrido aunque se eliminen aristas o vertices.
+    cada nodo retirado se libera cuando ya no queda ningun lector que haya empezado antes de su eliminacion.
+    NOTA: clear, copy, operator=, load y renumber reinician el grafo e invalidan todos los cursores; la guarda en si
+    sigue siendo valida y puede seguir abierta mientras el grafo se reconstruye
+    NOTA: las guardas y los cursores toleran escrituras intercaladas en el mismo hilo, no concurrentes: abrir y
+    cerrar una guarda modifica estado compartido sin sincronizar (la tabla de epocas fijadas, que puede reubicarse,
+    y el contador de lectores), igual que las escrituras. usar el grafo desde varios hilos, aunque todos sean
+    lectores con guarda, requiere un bloqueo externo alrededor de cada guarda, cursor y escritura */
+    class ReadGuard {
+    private:
+        const Graph<T, W>* graph; /* grafo protegido */
+        int slot; /* casilla de la epoca fijada */
+
+        ReadGuard(const ReadGuard&);
+        ReadGuard& operator=(const ReadGuard&);
+
+    public:
+        explicit ReadGuard(const Graph<T, W>& protectedGraph) : graph(&protectedGraph), slot(protectedGraph.pinEpoch()) {}
+        ~ReadGuard() { graph->unpinEpoch(slot); }
+    };
+
+    /* cursor de solo lectura sobre la lista de adyacencia de un vertice */
+    class NeighborCursor {
+    private:
+        const AdjacentNode<T, W>* current; /* nodo actual, NULL al terminar */
+
+    public:
+        explicit NeighborCursor(const AdjacentNode<T, W>* first = NULL) : current(first) {}
+        bool valid() const { return current != NULL; }
+        void next() { current = current->getNext(); }
+        const T& target() const { return current->getData()->getData(); }
+        int targetIndex() const { return current->getData()->getIndex(); }
+        W weight() const { return current->getWeight(); }
+    };
+
+    /* cursor sobre los vecinos de un vertice (vacio si el vertice no existe) */
+    NeighborCursor neighbors(const T& data) const {
+        VertexNode<T, W>* vertex = findVertex(data);
+        return NeighborCursor(vertex != NULL ? vertex->getNextAdjacent() : NULL);
+        /* complejidad promedio: o(1) */
+    }
+
+    /* libera los nodos retirados que ya no puede ver ningun lector activo
+    las escrituras lo invocan solas cuando no quedan lectores; retorna el numero de nodos liberados */
+    int reclaim() {
+        /* la epoca mas antigua fijada por un lector activo */
+        unsigned long oldest = std::numeric_limits<unsigned long>::max();
+        for (std::size_t i = 0; i < pinnedEpochs.size(); i++) {
+            if (pinnedEpochs[i] != 0 && pinnedEpochs[i] - 1 < oldest) oldest = pinnedEpochs[i] - 1;
+        }
+        /* un nodo retirado en la epoca e es visible para los lectores que fijaron una epoca <= e */
+        int released = 0;
+        std::size_t kept = 0;
+        for (std::size_t i = 0; i < retiredAdjacents.size(); i++) {
+            if (retiredAdjacents[i].second < oldest) {
+                adjacentPool.destroy(retiredAdjacents[i].first);
+                released++;
+            } else {
+                retiredAdjacents[kept++] = retiredAdjacents[i];
+            }
+        }
+        retiredAdjacents.resize(kept);
+        kept = 0;
+        for (std::size_t i = 0; i < retiredVertices.size(); i++) {
+            if (retiredVertices[i].second < oldest) {
+                vertexPool.destroy(retiredVertices[i].first);
+                released++;
+            } else {
+                retiredVertices[kept++] = retiredVertices[i];
+            }
+        }
+        retiredVertices.resize(kept);
+        return released;
+        /* complejidad: o(lectores activos + nodos retirados) */
+    }
+
+    /* numero de nodos retirados a la espera de ser liberados */
+    int getRetiredCount() const { return static_cast<int>(retiredVertices.size() + retiredAdjacents.size()); }
+
+    /* numero de lectores (ReadGuard) activos */
+    int getActiveReaderCount() const { return activeReaders; }
+
+    /* guarda el grafo en un archivo binario versionado (ver GraphSnapshot): tabla de indices y adyacencia csr
+    congela el grafo si no lo estaba; retorna false si no se pudo escribir el archivo */
+    bool save(const char* path) {
+        const CsrView& view = freeze();
+        std::vector<unsigned char> live(indexToNode.size(), 0);
+        for (std::size_t i = 0; i < indexToNode.size(); i++) {
+            live[i] = indexToNode[i] != NULL ? 1 : 0;
+        }
+        return GraphSnapshot<T>::save(path, snapshotKind(), SnapshotCodec<W>::tag(), view, indexToData, live, vertexCount, edgeCount);
+        /* complejidad: o(n + m), mas la construccion de la instantanea si el grafo cambio */
+    }
+
+    /* reemplaza el contenido del grafo por el de un archivo guardado con save por un grafo del mismo tipo
+    los vertices conservan sus indices y la adyacencia leida queda como instantanea csr vigente, asi que
+    las consultas por indice no necesitan volver a congelar el grafo
+    el archivo se valida completo (estructura, conteos y datos sin repetir) antes de tocar el grafo
+    retorna false (sin modificar el grafo) si el archivo no existe, esta dañado o es de otro tipo de grafo, de dato o de peso;
+    si falta memoria durante la restauracion retorna false y el grafo queda vacio */
+    bool load(const char* path) {
+        GraphSnapshot<T> snapshot;
+        if (!snapshot.load(path) || snapshot.getKind() != snapshotKind()
+            || snapshot.getWeightTag() != SnapshotCodec<W>::tag() || !snapshot.hasDistinctData()) return false;
+        clear();
+        if (!restoreVerticesFrom(snapshot.getIndexToData(), snapshot.getLiveSlots())) {
+            clear();
+            return false;
+        }
+        if (!restoreEdges(snapshot.getView())) {
+            clear();
+            return false;
+        }
+        edgeCount = snapshot.getEdgeCount();
+        markModified();
+        /* la instantanea del archivo tiene las filas ordenadas, igual que la que construiria freeze */
+        frozenView.adopt(snapshot.getView(), version);
+        frozen = true;
+        return true;
+        /* complejidad: o(n + m) */
+    }
+
+protected:
+    /* metodo protegido para buscar un nodo vertice por su dato */
+    VertexNode<T, W>* findVertex(const T& data) const {
+        /* resuelve el indice del dato con el indice hash */
+        const int* found = dataToIndex.find(data);
+        /* si el dato no se encuentra, devuelve NULL; si existe, devuelve el nodo guardado en su indice */
+        return found != NULL ? indexToNode[*found] : NULL;
+        /* complejidad promedio: o(1) */
+        /* complejidad peor caso: o(n) si todas las claves colisionan */
+    }
+
+    /* metodo protegido para buscar un nodo adyacente por el indice interno del vertice destino */
+    AdjacentNode<T, W>* findAdjacentByIndex(VertexNode<T, W>* vertex, int targetIndex) const {
+        /* vertice de grado alto: consulta su indice hash */
+        if (vertex != NULL && vertex->getAdjacencyIndex() != NULL) {
+            if (!containsVertexByIndex(targetIndex)) return NULL;
+            AdjacentNode<T, W>* const* found = vertex->getAdjacencyIndex()->find(indexToNode[targetIndex]);
+            return found != NULL ? *found : NULL;
+        }
+        for (AdjacentNode<T, W>* current = vertex ? vertex->getNextAdjacent() : NULL; current != NULL; current = current->getNext()) {
+            if (current->getData()->getIndex() == targetIndex) return current;
+        }
+        return NULL;
+        /* complejidad promedio: o(grado(vertex)) */
+        /* complejidad peor caso: o(n) */
+    }
+
+    /* metodo protegido para buscar un nodo adyacente en la lista de adyacencia de un vertice */
+    AdjacentNode<T, W>* findAdjacent(VertexNode<T, W>* vertex, const T& targetData) const {
+        /* si el vertice es NULL o su lista de adyacencia esta vacia, no hay adyacentes */
+        if (!vertex || !vertex->getNextAdjacent()) {
+            return NULL;
+        }
+        /* vertice de grado alto: resuelve el destino con el indice de vertices y consulta el indice hash de adyacencia */
+        if (vertex->getAdjacencyIndex() != NULL) {
+            VertexNode<T, W>* target = findVertex(targetData);
+            if (target == NULL) return NULL;
+            AdjacentNode<T, W>* const* found = vertex->getAdjacencyIndex()->find(target);
+            return found != NULL ? *found : NULL;
+        }
+        /* comienza la busqueda desde el primer nodo adyacente */
+        AdjacentNode<T, W>* current = vertex->getNextAdjacent();
+        /* recorre la lista de adyacencia hasta encontrar el nodo con el dato destino o llegar al final */
+        while (current != NULL) {
+            /* si el nodo adyacente actual apunta al vertice con el dato destino, devuelve el nodo adyacente */
+            if (current->getData()->getData() == targetData) {
+                return current;
+            }
+            /* avanza al siguiente nodo adyacente */
+            current = current->getNext();
+        }
+        /* si no se encuentra el nodo adyacente, devuelve NULL */
+        return NULL;
+        /* complejidad promedio: o(grado(vertex)) para listas cortas, o(1) para vertices de grado alto */
+        /* complejidad peor caso: o(hubDegreeThreshold) para listas cortas, o(n) si todas las claves colisionan */
+    }
+};
+
 #endif
\ No newline at end of file
@@ -0,0 +1,357 @@
+#ifndef GRAPHSNAPSHOT_H
+#define GRAPHSNAPSHOT_H
+
+#include <cstdio>
+#include <cstring> /* para memcmp y memcpy */
+#include <limits> /* para numeric_limits */
+#include <string>
+#include <vector>
+#include "CsrView.hpp"
+#include "../Hash/HashMap.hpp"
+
+/* tipo de grafo guardado en un archivo: un archivo solo se carga en un grafo del mismo tipo */
+enum SnapshotKind {
+    SNAPSHOT_NON_DIRECTED = 1,
+    SNAPSHOT_DIRECTED = 2,
+    SNAPSHOT_DENSE_NON_DIRECTED = 3
+};
+
+/* codificacion de los datos de los vertices en el archivo
+la version generica copia los bytes de cada dato en un solo bloque, por lo que solo es correcta para tipos
+sin memoria dinamica (igual que HashFunction); los tipos que administran memoria deben especializarla
+readAll recibe los bytes que quedan en el archivo y debe rechazar conteos que no caben en ellos antes de reservar */
+template <typename T>
+struct SnapshotCodec {
+    /* identifica el tipo en la cabecera para rechazar archivos escritos con otro tipo de dato
+    combina la familia (bytes sin interpretar, entero o flotante), el signo y el tamaño, asi que int, unsigned
+    int y float tienen etiquetas distintas aunque ocupen los mismos bytes */
+    static unsigned int tag() {
+        typedef std::numeric_limits<T> limits;
+        unsigned int family = !limits::is_specialized ? 1U : (limits::is_integer ? 2U : 3U);
+        unsigned int sign = limits::is_signed ? 1U : 0U;
+        return (family << 28) | (sign << 27) | (static_cast<unsigned int>(sizeof(T)) & 0x07ffffffU);
+    }
+
+    static bool writeAll(std::FILE* file, const std::vector<T>& data) {
+        return data.empty() || std::fwrite(&data[0], sizeof(T), data.size(), file) == data.size();
+        /* complejidad: o(n) en una sola escritura */
+    }
+
+    static bool readAll(std::FILE* file, std::vector<T>& data, int count, std::size_t& remaining) {
+        if (static_cast<std::size_t>(count) > remaining / sizeof(T)) return false;
+        data.resize(count);
+        remaining -= data.size() * sizeof(T);
+        return count == 0 || std::fread(&data[0], sizeof(T), data.size(), file) == data.size();
+        /* complejidad: o(n) en una sola lectura */
+    }
+};
+
+/* codificacion de cadenas: longitud seguida de los caracteres */
+template <>
+struct SnapshotCodec<std::string> {
+    static unsigned int tag() { return 0x53545200U; } /* "STR" */
+
+    static bool writeAll(std::FILE* file, const std::vector<std::string>& data) {
+        for (std::size_t i = 0; i < data.size(); i++) {
+            unsigned int length = static_cast<unsigned int>(data[i].size());
+            if (std::fwrite(&length, sizeof(length), 1, file) != 1) return false;
+            if (length > 0 && std::fwrite(data[i].data(), 1, length, file) != length) return false;
+        }
+        return true;
+        /* complejidad: o(n + suma de longitudes) */
+    }
+
+    static bool readAll(std::FILE* file, std::vector<std::string>& data, int count, std::size_t& remaining) {
+        /* cada cadena ocupa al menos su longitud */
+        if (static_cast<std::size_t>(count) > remaining / sizeof(unsigned int)) return false;
+        data.assign(count, std::string());
+        std::vector<char> buffer;
+        for (int i = 0; i < count; i++) {
+            unsigned int length;
+            if (std::fread(&length, sizeof(length), 1, file) != 1) return false;
+            remaining -= sizeof(length);
+            if (length > remaining) return false;
+            remaining -= length;
+            buffer.resize(length);
+            if (length > 0 && std::fread(&buffer[0], 1, length, file) != length) return false;
+            data[i].assign(buffer.begin(), buffer.end());
+        }
+        return true;
+        /* complejidad: o(n + suma de longitudes) */
+    }
+};
+
+/* cabecera del archivo: todos los campos son de 32 bits, sin relleno (el relleno hasta 8 bytes va despues) */
+struct SnapshotHeader {
+    char magic[8]; /* "GRAPHSNP" */
+    unsigned int formatVersion; /* version del formato, se rechazan versiones desconocidas */
+    unsigned int byteOrder; /* 0x01020304 escrito en el orden de la maquina: detecta archivos de otra arquitectura */
+    unsigned int kind; /* SnapshotKind */
+    unsigned int dataTag; /* SnapshotCodec<T>::tag() */
+    unsigned int weightTag; /* SnapshotCodec<W>::tag() del grafo guardado; los pesos se escriben como double */
+    int slots; /* casillas de la tabla de indices (vertices vivos y lapidas) */
+    int vertexCount; /* vertices vivos */
+    int edgeCount; /* aristas del grafo */
+    int entryCount; /* entradas de adyacencia de la instantanea csr */
+};
+
+/* instantanea binaria de un grafo: tabla de indices y adyacencia csr
+disposicion del archivo (version 2), con cada seccion de tamaño fijo alineada a 8 bytes:
+  cabecera | ocupacion de cada casilla (1 byte) | offsets (int, casillas + 1) | vecinos (int, entradas)
+  | pesos (double, entradas) | datos de los vertices (SnapshotCodec, uno por casilla)
+cada seccion se lee con una sola llamada a fread directamente sobre la memoria final, sin interpretar
+elemento por elemento, y la adyacencia queda lista como CsrView */
+template <typename T, typename Codec = SnapshotCodec<T> >
+class GraphSnapshot {
+private:
+    CsrView view; /* adyacencia leida del archivo */
+    std::vector<T> indexToData; /* dato de cada casilla (T() en las lapidas) */
+    std::vector<unsigned char> live; /* 1 si la casilla tiene un vertice */
+    unsigned int kind; /* tipo de grafo guardado */
+    unsigned int weightTag; /* etiqueta del tipo de peso del grafo guardado */
+    int vertexCount; /* vertices vivos */
+    int edgeCount; /* aristas del grafo */
+    mutable HashMap<T, int> dataToIndex; /* indice hash desde el dato, se construye en la primera busqueda */
+    mutable bool indexed; /* indica si dataToIndex ya fue construido */
+    mutable bool distinct; /* indica si los datos de los vertices vivos no se repiten (valido si indexed) */
+
+    static const unsigned int currentFormatVersion = 2;
+    static unsigned int byteOrderMark() { return 0x01020304U; }
+
+    /* escribe ceros hasta alinear la posicion a 8 bytes */
+    static bool pad(std::FILE* file, std::size_t written) {
+        static const char zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+        std::size_t extra = (8 - written % 8) % 8;
+        return extra == 0 || std::fwrite(zeros, 1, extra, file) == extra;
+    }
+
+    /* salta el relleno de alineacion y lo descuenta de los bytes restantes */
+    static bool skipPad(std::FILE* file, std::size_t read, std::size_t& remaining) {
+        std::size_t extra = (8 - read % 8) % 8;
+        if (extra > remaining) return false;
+        remaining -= extra;
+        return extra == 0 || std::fseek(file, static_cast<long>(extra), SEEK_CUR) == 0;
+    }
+
+    /* construye el indice hash desde el dato la primera vez que se necesita */
+    void buildIndex() const {
+        if (indexed) return;
+        dataToIndex.reserve(static_cast<std::size_t>(vertexCount));
+        distinct = true;
+        for (std::size_t i = 0; i < live.size(); i++) {
+            if (live[i] && !dataToIndex.insert(indexToData[i], static_cast<int>(i))) distinct = false;
+        }
+        indexed = true;
+        /* complejidad promedio: o(n) */
+    }
+
+    /* bytes del archivo desde la posicion actual hasta el final; retorna false si no se pueden medir */
+    static bool remainingBytes(std::FILE* file, std::size_t& remaining) {
+        long here = std::ftell(file);
+        if (here < 0 || std::fseek(file, 0, SEEK_END) != 0) return false;
+        long end = std::ftell(file);
+        if (end < here || std::fseek(file, here, SEEK_SET) != 0) return false;
+        remaining = static_cast<std::size_t>(end - here);
+        return true;
+    }
+
+    /* escribe un arreglo como una seccion alineada */
+    template <typename E>
+    static bool writeSection(std::FILE* file, const E* data, std::size_t count) {
+        if (count > 0 && std::fwrite(data, sizeof(E), count, file) != count) return false;
+        return pad(file, count * sizeof(E));
+    }
+
+    /* lee una seccion alineada directamente sobre el vector de destino
+    el conteo viene del archivo: se rechaza antes de reservar si la seccion no cabe en los bytes restantes */
+    template <typename E>
+    static bool readSection(std::FILE* file, std::vector<E>& data, std::size_t count, std::size_t& remaining) {
+        if (count > remaining / sizeof(E)) return false;
+        data.resize(count);
+        remaining -= count * sizeof(E);
+        if (count > 0 && std::fread(&data[0], sizeof(E), count, file) != count) return false;
+        return skipPad(file, count * sizeof(E), remaining);
+    }
+
+public:
+    GraphSnapshot() : kind(0), weightTag(0), vertexCount(0), edgeCount(0), indexed(false), distinct(true) {}
+
+    /* guarda una instantanea en un archivo; retorna false si no se pudo escribir completo */
+    static bool save(const char* path, unsigned int graphKind, unsigned int graphWeightTag, const CsrView& adjacency,
+                     const std::vector<T>& data, const std::vector<unsigned char>& occupied,
+                     int vertices, int edges) {
+        /* la instantanea debe cubrir exactamente la tabla de indices */
+        if (adjacency.getVertexSlots() != static_cast<int>(data.size()) || occupied.size() != data.size()) return false;
+        std::FILE* file = std::fopen(path, "wb");
+        if (!file) return false;
+        SnapshotHeader header;
+        std::memcpy(header.magic, "GRAPHSNP", 8);
+        header.formatVersion = currentFormatVersion;
+        header.byteOrder = byteOrderMark();
+        header.kind = graphKind;
+        header.dataTag = Codec::tag();
+        header.weightTag = graphWeightTag;
+        header.slots = static_cast<int>(data.size());
+        header.vertexCount = vertices;
+        header.edgeCount = edges;
+        header.entryCount = adjacency.getEntryCount();
+
+        /* las filas de la instantanea son contiguas: cada arreglo se escribe en un bloque */
+        const std::vector<int>& offsets = adjacency.getOffsets();
+        const std::vector<int>& neighbors = adjacency.getNeighbors();
+        const std::vector<double>& weights = adjacency.getWeights();
+        bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1
+            && pad(file, sizeof(header))
+            && writeSection(file, occupied.empty() ? NULL : &occupied[0], occupied.size())
+            && writeSection(file, &offsets[0], offsets.size())
+            && writeSection(file, neighbors.empty() ? NULL : &neighbors[0], neighbors.size())
+            && writeSection(file, weights.empty() ? NULL : &weights[0], weights.size())
+            && Codec::writeAll(file, data);
+        ok = std::fclose(file) == 0 && ok;
+        return ok;
+        /* complejidad: o(n + m) */
+    }
+
+    /* carga una instantanea desde un archivo; retorna false si no existe, esta truncado o no es compatible */
+    bool load(const char* path) {
+        std::FILE* file = std::fopen(path, "rb");
+        if (!file) return false;
+        SnapshotHeader header;
+        std::size_t remaining = 0;
+        bool ok = std::fread(&header, sizeof(header), 1, file) == 1
+            && std::memcmp(header.magic, "GRAPHSNP", 8) == 0
+            && header.formatVersion == currentFormatVersion
+            && header.byteOrder == byteOrderMark()
+            && header.dataTag == Codec::tag()
+            && header.slots >= 0 && header.entryCount >= 0
+            && header.vertexCount >= 0 && header.edgeCount >= 0
+            && remainingBytes(file, remaining)
+            && skipPad(file, sizeof(header), remaining);
+
+        std::vector<int> offsets;
+        std::vector<int> neighbors;
+        std::vector<double> weights;
+        std::size_t slots = static_cast<std::size_t>(ok ? header.slots : 0);
+        ok = ok && readSection(file, live, slots, remaining)
+            && readSection(file, offsets, slots + 1, remaining)
+            && readSection(file, neighbors, header.entryCount, remaining)
+            && readSection(file, weights, header.entryCount, remaining)
+            && Codec::readAll(file, indexToData, header.slots, remaining);
+        std::fclose(file);
+
+        /* valida la estructura antes de publicarla: offsets crecientes y vecinos dentro de la tabla */
+        int liveCount = 0;
+        for (int i = 0; ok && i < header.slots; i++) {
+            ok = offsets[i] <= offsets[i + 1] && (live[i] || offsets[i] == offsets[i + 1]);
+            if (live[i]) liveCount++;
+        }
+        ok = ok && offsets[0] == 0 && offsets[header.slots] == header.entryCount && liveCount == header.vertexCount;
+        /* un lazo ocupa en su fila una entrada por mitad guardada: una en el grafo dirigido y en el denso (un bit),
+        dos en el no dirigido con listas; restoreEdges crea un solo lazo por fila */
+        int loopEntries = header.kind == SNAPSHOT_NON_DIRECTED ? 2 : 1;
+        long loops = 0;
+        for (int u = 0; ok && u < header.slots; u++) {
+            int rowLoops = 0;
+            for (int e = offsets[u]; ok && e < offsets[u + 1]; e++) {
+                /* filas ordenadas como las de freeze: un vecino repetido solo puede ser un lazo */
+                ok = neighbors[e] >= 0 && neighbors[e] < header.slots && live[neighbors[e]]
+                    && (e == offsets[u] || neighbors[e - 1] < neighbors[e] || (neighbors[e - 1] == neighbors[e] && neighbors[e] == u));
+                if (ok && neighbors[e] == u) rowLoops++;
+            }
+            ok = ok && (rowLoops == 0 || rowLoops == loopEntries);
+            if (rowLoops > 0) loops++;
+        }
+        /* en un grafo no dirigido la fila u nombra a v exactamente cuando la fila v nombra a u, con el mismo peso
+        como las filas estan ordenadas, al recorrer u en orden las entradas hacia v aparecen en el orden de la fila v:
+        un cursor por fila las consume y al final cada cursor debe haber llegado al final de su fila (saltando lazos) */
+        if (ok && header.kind != SNAPSHOT_DIRECTED) {
+            std::vector<int> cursor(offsets.begin(), offsets.end() - 1);
+            for (int u = 0; ok && u < header.slots; u++) {
+                for (int e = offsets[u]; ok && e < offsets[u + 1]; e++) {
+                    int v = neighbors[e];
+                    if (v == u) continue;
+                    int& c = cursor[v];
+                    while (c < offsets[v + 1] && neighbors[c] == v) c++;
+                    ok = c < offsets[v + 1] && neighbors[c] == u && weights[c] == weights[e];
+                    c++;
+                }
+            }
+            for (int v = 0; ok && v < header.slots; v++) {
+                int c = cursor[v];
+                while (c < offsets[v + 1] && neighbors[c] == v) c++;
+                ok = c == offsets[v + 1];
+            }
+        }
+        /* los conteos de la cabecera deben coincidir con las secciones leidas: en un grafo dirigido cada
+        arista es una entrada; en uno no dirigido cada arista entre vertices distintos ocupa dos y cada lazo loopEntries */
+        if (ok && header.kind == SNAPSHOT_DIRECTED) {
+            ok = header.edgeCount == header.entryCount;
+        } else if (ok) {
+            ok = header.edgeCount == (header.entryCount - loops * loopEntries) / 2 + loops;
+        }
+        if (!ok) {
+            clear();
+            return false;
+        }
+
+        view.adopt(offsets, neighbors, weights, 0);
+        kind = header.kind;
+        weightTag = header.weightTag;
+        vertexCount = header.vertexCount;
+        edgeCount = header.edgeCount;
+        dataToIndex.clear();
+        indexed = false;
+        return true;
+        /* complejidad: o(n + m), con una lectura por seccion */
+    }
+
+    /* libera la instantanea cargada */
+    void clear() {
+        view.release();
+        std::vector<T>().swap(indexToData);
+        std::vector<unsigned char>().swap(live);
+        dataToIndex.clear();
+        indexed = false;
+        distinct = true;
+        kind = weightTag = 0;
+        vertexCount = edgeCount = 0;
+    }
+
+    unsigned int getKind() const { return kind; }
+    unsigned int getWeightTag() const { return weightTag; }
+    int getVertexCount() const { return vertexCount; }
+    int getEdgeCount() const { return edgeCount; }
+    int getIndexCapacity() const { return static_cast<int>(live.size()); }
+
+    /* adyacencia csr indexada por los indices internos del grafo guardado */
+    const CsrView& getView() const { return view; }
+    CsrView& getView() { return view; }
+
+    const std::vector<T>& getIndexToData() const { return indexToData; }
+    const std::vector<unsigned char>& getLiveSlots() const { return live; }
+
+    bool containsVertexByIndex(int index) const {
+        return index >= 0 && index < static_cast<int>(live.size()) && live[index] != 0;
+    }
+
+    T getDataByIndex(int index) const {
+        return containsVertexByIndex(index) ? indexToData[index] : T();
+    }
+
+    /* indica si ningun dato se repite entre los vertices vivos, condicion para restaurar la instantanea en un grafo
+    la primera llamada construye el indice hash en o(n) */
+    bool hasDistinctData() const {
+        buildIndex();
+        return distinct;
+    }
+
+    /* indice de un dato, o -1 si no existe; la primera llamada construye el indice hash en o(n) */
+    int getIndexByData(const T& data) const {
+        buildIndex();
+        const int* found = dataToIndex.find(data);
+        return found != NULL ? *found : -1;
+        /* complejidad promedio: o(1) despues de la primera llamada */
+    }
+};
+
+#endif
@@ -2,51 +2,41 @@
 #define NONDIRECTEDGRAPH_H
 
 #include "Graph.hpp"
-#include <map>
+#include <vector>
+#include <iterator> /* para distance */
+#include <algorithm> /* para stable_sort */
 
 /*
  * @brief Clase derivada para representar un grafo no dirigido.
- * Hereda de la clase base Graph<T> e implementa la lógica específica
+ * Hereda de la clase base Graph<T, W> e implementa la lógica específica
  * para aristas no dirigidas, donde una conexión entre dos vértices
  * es bidireccional.
  *
  * @tparam T El tipo de dato almacenado en los vértices del grafo.
  */
-template <typename T>
-class NonDirectedGraph : public Graph<T> {
+template <typename T, typename W = double>
+class NonDirectedGraph : public Graph<T, W> {
 public:
     /*
      * @brief Constructor predeterminado de la clase NonDirectedGraph.
-     * Llama al constructor de la clase base Graph<T>.
+     * Llama al constructor de la clase base Graph<T, W>.
      */
-    NonDirectedGraph() : Graph<T>() {}
+    NonDirectedGraph() : Graph<T, W>(), batchStamp(0) {}
 
     /*
      * @brief Constructor de copia de la clase NonDirectedGraph.
-     * Llama al constructor de copia de la clase base Graph<T> y luego copia las aristas.
+     * Llama al constructor de copia de la clase base Graph<T, W> y luego copia las aristas.
      *
      * @param other El grafo no dirigido del cual se creará una copia.
      */
-    NonDirectedGraph(const NonDirectedGraph<T>& other) : Graph<T>(other) {
-        /* Mapa para almacenar la correspondencia entre los nodos del grafo original y los nodos del nuevo grafo. */
-        std::map<VertexNode<T>*, VertexNode<T>*> nodeMap;
-        /* Recorre los nodos del grafo original y los busca en el nuevo grafo para llenar el mapa. */
-        VertexNode<T>* currentOther = other.firstNode;
-        VertexNode<T>* currentThis = this->firstNode;
-        while (currentOther != NULL && currentThis != NULL) {
-            nodeMap[currentOther] = currentThis;
-            currentOther = currentOther->getNextVertex();
-            currentThis = currentThis->getNextVertex();
-        }
-        /* Llama a la función para copiar las aristas. */
-        copyEdges(other, nodeMap);
-        /* Copia el contador de aristas. */
-        this->edgeCount = other.edgeCount;
+    NonDirectedGraph(const NonDirectedGraph<T, W>& other) : Graph<T, W>(other), batchStamp(0) {
+        /* La clase base ya copió los vértices con los mismos índices; solo falta copiar las aristas y su contador. */
+        this->finishCopy(other);
     }
 
     /*
      * @brief Destructor virtual de la clase NonDirectedGraph.
-     * Llama al destructor virtual de la clase base Graph<T>, asegurando
+     * Llama al destructor virtual de la clase base Graph<T, W>, asegurando
      * la correcta liberación de memoria.
      */
     virtual ~NonDirectedGraph() {}
@@ -60,16 +50,21 @@ public:
     virtual void addVertex(const T& data) {
         /* Verifica si el vértice ya existe para evitar duplicados. */
         if (this->findVertex(data) == NULL) {
-            /* Agrega el dato al sistema de mapeo de la clase base. */
-            this->addToMappings(data);
             /* Crea un nuevo nodo de vértice. */
-            VertexNode<T>* newNode = new (std::nothrow) VertexNode<T>(data, this->firstNode);
+            VertexNode<T, W>* newNode = this->createVertexNode(data, NULL);
             /* Si la asignación de memoria fue exitosa. */
             if (newNode) {
-                /* Actualiza el puntero al primer nodo. */
-                this->firstNode = newNode;
+                /* Agrega el nodo al sistema de mapeo de la clase base; si no hay índices disponibles, descarta el nodo. */
+                if (!this->addToMappings(newNode)) {
+                    this->destroyVertexNode(newNode);
+                    return;
+                }
+                /* Enlaza el nodo al inicio de la lista de vértices. */
+                this->linkVertex(newNode);
                 /* Incrementa el contador de vértices. */
                 this->vertexCount++;
+                /* Registra la mutación (invalida la instantánea CSR). */
+                this->markModified();
             } else {
                 /* Manejo de error si falla la asignación de memoria. */
                 /* Podrías lanzar una excepción o manejar el error de otra manera. */
@@ -79,46 +74,50 @@ public:
         /* Si el vértice ya existe, no se hace nada. */
     }
 
+    /*
+     * @brief Elimina un vértice y todas sus aristas.
+     * Cada arista se elimina desde la lista del propio vértice usando su mitad gemela,
+     * por lo que el costo es O(grado) en lugar de recorrer todo el grafo.
+     *
+     * @param data El dato del vértice a eliminar.
+     */
     virtual void removeVertex(const T& data) {
         /* Busca el nodo del vértice a eliminar. */
-        VertexNode<T>* toRemove = this->findVertex(data);
+        VertexNode<T, W>* toRemove = this->findVertex(data);
         if (toRemove) {
-            /* 1. Elimina las aristas que tienen a este vértice como destino en otros vértices. */
-            VertexNode<T>* currentVertex = this->firstNode;
-            while (currentVertex != NULL) {
-                removeEdgeInternal(currentVertex, toRemove);
-                currentVertex = currentVertex->getNextVertex();
-            }
-    
-            /* 2. Elimina las aristas adyacentes al vértice a eliminar y cuenta las aristas eliminadas. */
-            AdjacentNode<T>* currentAdjacent = toRemove->getNextAdjacent();
+            /* 1. Recorre la lista de adyacencia del vértice: cada mitad se elimina junto con su gemela en la lista del vecino. */
+            AdjacentNode<T, W>* currentAdjacent = toRemove->getNextAdjacent();
             int deletedEdges = 0;
+            int selfLoopHalves = 0;
             while (currentAdjacent != NULL) {
-                AdjacentNode<T>* nextAdjacent = currentAdjacent->getNext();
-                delete currentAdjacent;
+                AdjacentNode<T, W>* nextAdjacent = currentAdjacent->getNext();
+                VertexNode<T, W>* neighbor = currentAdjacent->getData();
+                if (neighbor != toRemove) {
+                    /* Desenlaza la mitad gemela de la lista del vecino en O(1). */
+                    AdjacentNode<T, W>* twin = currentAdjacent->getTwin();
+                    if (twin != NULL) {
+                        this->unlinkAdjacent(neighbor, twin);
+                        this->destroyAdjacentNode(twin);
+                    }
+                    deletedEdges++;
+                } else {
+                    /* Un lazo tiene sus dos mitades en esta misma lista: se cuentan como una sola arista. */
+                    selfLoopHalves++;
+                }
+                this->destroyAdjacentNode(currentAdjacent);
                 currentAdjacent = nextAdjacent;
-                deletedEdges++;
             }
             toRemove->setNextAdjacent(NULL);
-            this->edgeCount -= deletedEdges;
-    
-            /* 3. Elimina el nodo del vértice de la lista enlazada de vértices. */
-            if (toRemove == this->firstNode) {
-                this->firstNode = toRemove->getNextVertex();
-            } else {
-                VertexNode<T>* prevVertex = this->firstNode;
-                while (prevVertex != NULL && prevVertex->getNextVertex() != toRemove) {
-                    prevVertex = prevVertex->getNextVertex();
-                }
-                if (prevVertex != NULL) {
-                    prevVertex->setNextVertex(toRemove->getNextVertex());
-                }
-            }
-    
-            /* 4. Elimina el vértice del sistema de mapeo y decrementa el contador de vértices. */
+            this->edgeCount -= deletedEdges + (selfLoopHalves + 1) / 2;
+
+            /* 2. Desenlaza el nodo de la lista doblemente enlazada de vértices. */
+            this->unlinkVertex(toRemove);
+
+            /* 3. Elimina el vértice del sistema de mapeo y decrementa el contador de vértices. */
             this->removeFromMappings(data);
             this->vertexCount--;
-            delete toRemove;
+            this->destroyVertexNode(toRemove);
+            this->markModified();
         }
     }
     
@@ -131,37 +130,40 @@ public:
      * @param destination El dato del vértice de destino.
      * @param weight El peso de la arista (por defecto es 1.0).
      */
-    virtual void addEdge(const T& source, const T& destination, double weight = 1.0) {
+    virtual void addEdge(const T& source, const T& destination, const W& weight = W(1)) {
         /* Busca los nodos de los vértices de origen y destino. */
-        VertexNode<T>* sourceVertex = this->findVertex(source);
-        VertexNode<T>* destinationVertex = this->findVertex(destination);
+        VertexNode<T, W>* sourceVertex = this->findVertex(source);
+        VertexNode<T, W>* destinationVertex = this->findVertex(destination);
 
         /* Verifica si ambos vértices existen. */
         if (sourceVertex && destinationVertex) {
             /* Verifica si la arista ya existe para evitar duplicados. */
             if (!this->findAdjacent(sourceVertex, destination) && !this->findAdjacent(destinationVertex, source)) {
                 /* Crea un nuevo nodo adyacente para el destino en la lista de adyacencia del origen. */
-                AdjacentNode<T>* newAdjacentSource = new (std::nothrow) AdjacentNode<T>(destinationVertex, weight);
+                AdjacentNode<T, W>* newAdjacentSource = this->createAdjacentNode(destinationVertex, weight);
                 if (newAdjacentSource) {
-                    newAdjacentSource->setNext(sourceVertex->getNextAdjacent());
-                    sourceVertex->setNextAdjacent(newAdjacentSource);
+                    this->linkAdjacent(sourceVertex, newAdjacentSource);
                 } else {
                     /* Manejo de error si falla la asignación de memoria. */
                     return;
                 }
 
                 /* Crea un nuevo nodo adyacente para el origen en la lista de adyacencia del destino. */
-                AdjacentNode<T>* newAdjacentDestination = new (std::nothrow) AdjacentNode<T>(sourceVertex, weight);
+                AdjacentNode<T, W>* newAdjacentDestination = this->createAdjacentNode(sourceVertex, weight);
                 if (newAdjacentDestination) {
-                    newAdjacentDestination->setNext(destinationVertex->getNextAdjacent());
-                    destinationVertex->setNextAdjacent(newAdjacentDestination);
+                    this->linkAdjacent(destinationVertex, newAdjacentDestination);
                 } else {
-                    /* Manejo de error: podría ser necesario deshacer la adición anterior. */
-                    delete newAdjacentSource;
+                    /* Manejo de error: deshace la adición anterior. */
+                    this->unlinkAdjacent(sourceVertex, newAdjacentSource);
+                    this->destroyAdjacentNode(newAdjacentSource);
                     return;
                 }
+                /* Enlaza las dos mitades de la arista entre sí. */
+                newAdjacentSource->setTwin(newAdjacentDestination);
+                newAdjacentDestination->setTwin(newAdjacentSource);
                 /* Incrementa el contador de aristas (ya que es no dirigido, contamos una sola vez). */
                 this->edgeCount++;
+                this->markModified();
             }
             /* Si la arista ya existe, no se hace nada. */
         }
@@ -176,18 +178,15 @@ public:
      * @param destination El dato del vértice de destino.
      */
     virtual void removeEdge(const T& source, const T& destination) {
-        VertexNode<T>* srcNode = this->findVertex(source);
-        VertexNode<T>* destNode = this->findVertex(destination);
-    
-        if (srcNode && destNode) {
-            /* Intenta eliminar la arista desde la fuente hacia el destino. */
-            bool removedFromSource = this->removeEdgeInternal(srcNode, destNode);
-            /* Intenta eliminar la arista desde el destino hacia la fuente. */
-            bool removedFromDest = this->removeEdgeInternal(destNode, srcNode);
+        VertexNode<T, W>* srcNode = this->findVertex(source);
     
-            /* Si al menos una de las eliminaciones fue exitosa, decrementa el contador. */
-            if (removedFromSource || removedFromDest) {
+        if (srcNode) {
+            /* Busca la mitad de la arista en la lista del origen; la otra mitad se alcanza por su gemela. */
+            AdjacentNode<T, W>* half = this->findAdjacent(srcNode, destination);
+            if (half != NULL) {
+                removeEdgeInternal(srcNode, half);
                 this->edgeCount--;
+                this->markModified();
             }
         }
     }
@@ -203,90 +202,288 @@ public:
      */
     virtual bool areAdjacent(const T& source, const T& destination) const {
         /* Busca el nodo del vértice de origen. */
-        VertexNode<T>* sourceVertex = this->findVertex(source);
+        VertexNode<T, W>* sourceVertex = this->findVertex(source);
         /* Si el vértice de origen existe, busca el destino en su lista de adyacencia. */
         return sourceVertex ? this->findAdjacent(sourceVertex, destination) != NULL : false;
     }
 
+    /*
+     * @brief Agrega en bloque los vértices de un rango [first, last).
+     * Reserva de una vez el espacio del sistema de mapeo para todo el rango; los datos repetidos se ignoran.
+     * La reserva crece al menos al doble de la capacidad actual, así que llamadas sucesivas con rangos
+     * pequeños (por ejemplo, un bloque de un archivo por vez) no copian la tabla de índices en cada llamada.
+     *
+     * @param first Iterador (al menos de avance) al primer dato.
+     * @param last Iterador al final del rango.
+     */
+    template <typename ForwardIterator>
+    void addVertices(ForwardIterator first, ForwardIterator last) {
+        int needed = this->nextIndex + static_cast<int>(std::distance(first, last));
+        int capacity = static_cast<int>(this->indexToNode.capacity());
+        if (needed > capacity) this->reserveVertices(needed > 2 * capacity ? needed : 2 * capacity);
+        for (; first != last; ++first) {
+            addVertex(*first);
+        }
+    }
+
+    /*
+     * @brief Agrega en bloque un conjunto de aristas.
+     * Resuelve cada extremo una sola vez a su índice interno y ordena el lote por el menor índice:
+     * con un ordenamiento por conteo estable si el lote es comparable al número de índices, o con un
+     * ordenamiento estable por comparación si es mucho menor, para que el costo no dependa del tamaño del grafo.
+     * Dentro de cada grupo se descartan las aristas repetidas (gana la primera aparición, igual que con
+     * llamadas sucesivas a addEdge) y las que ya existían en el grafo: en los vértices con índice hash de
+     * adyacencia se consulta el índice, en los demás (a lo sumo hubDegreeThreshold vecinos) se marcan los
+     * vecinos una sola vez. Las marcas son sellos en un arreglo que se conserva entre llamadas, así que no
+     * hay que limpiarlo. Las listas se construyen en una pasada. Las aristas con extremos inexistentes se ignoran.
+     *
+     * @param edges Las aristas a agregar.
+     * @return El número de aristas nuevas agregadas.
+     */
+    int addEdges(const std::vector<typename Graph<T, W>::Edge>& edges) {
+        /* 1. Resuelve los extremos de cada arista a índices internos. */
+        int slots = static_cast<int>(this->indexToNode.size());
+        std::vector<BatchEdge> batch;
+        batch.reserve(edges.size());
+        for (std::size_t i = 0; i < edges.size(); i++) {
+            const int* sourceIndex = this->dataToIndex.find(edges[i].source);
+            const int* destinationIndex = this->dataToIndex.find(edges[i].destination);
+            if (sourceIndex == NULL || destinationIndex == NULL) continue;
+            BatchEdge entry;
+            entry.low = *sourceIndex < *destinationIndex ? *sourceIndex : *destinationIndex;
+            entry.high = *sourceIndex < *destinationIndex ? *destinationIndex : *sourceIndex;
+            entry.weight = edges[i].weight;
+            batch.push_back(entry);
+        }
+
+        /* 2. Agrupa por el menor índice en forma estable: la primera aparición queda primera en su grupo. */
+        if (static_cast<std::size_t>(slots) <= 4 * batch.size()) {
+            std::vector<int> start(slots + 1, 0);
+            for (std::size_t k = 0; k < batch.size(); k++) {
+                start[batch[k].low + 1]++;
+            }
+            for (int v = 0; v < slots; v++) {
+                start[v + 1] += start[v];
+            }
+            std::vector<BatchEdge> sorted(batch.size());
+            for (std::size_t k = 0; k < batch.size(); k++) {
+                sorted[start[batch[k].low]++] = batch[k];
+            }
+            batch.swap(sorted);
+        } else {
+            std::stable_sort(batch.begin(), batch.end(), BatchEdgeOrder());
+        }
+
+        /* 3. Recorre el lote agrupado por el menor índice y construye las listas en una pasada. */
+        if (batchMark.size() < static_cast<std::size_t>(slots)) batchMark.resize(slots, 0);
+        int added = 0;
+        std::size_t i = 0;
+        while (i < batch.size()) {
+            int low = batch[i].low;
+            VertexNode<T, W>* lowVertex = this->indexToNode[low];
+            /* sello nuevo del grupo: marca los vecinos actuales si el vértice no tiene índice hash */
+            unsigned long stamp = ++batchStamp;
+            if (lowVertex->getAdjacencyIndex() == NULL) {
+                for (AdjacentNode<T, W>* adj = lowVertex->getNextAdjacent(); adj != NULL; adj = adj->getNext()) {
+                    batchMark[adj->getData()->getIndex()] = stamp;
+                }
+            }
+            for (; i < batch.size() && batch[i].low == low; i++) {
+                int high = batch[i].high;
+                VertexNode<T, W>* highVertex = this->indexToNode[high];
+                /* descarta repeticiones dentro del lote y aristas que ya estaban en el grafo; el índice hash,
+                si existe o se crea al crecer la lista, ya contiene las aristas agregadas en este grupo */
+                if (batchMark[high] == stamp) continue;
+                if (lowVertex->getAdjacencyIndex() != NULL && lowVertex->getAdjacencyIndex()->contains(highVertex)) continue;
+                batchMark[high] = stamp;
+                AdjacentNode<T, W>* lowHalf = this->createAdjacentNode(highVertex, batch[i].weight);
+                AdjacentNode<T, W>* highHalf = this->createAdjacentNode(lowVertex, batch[i].weight);
+                if (!lowHalf || !highHalf) {
+                    /* sin memoria: se conserva lo agregado hasta ahora */
+                    this->destroyAdjacentNode(lowHalf);
+                    this->destroyAdjacentNode(highHalf);
+                    i = batch.size();
+                    break;
+                }
+                this->linkAdjacent(lowVertex, lowHalf);
+                this->linkAdjacent(highVertex, highHalf);
+                lowHalf->setTwin(highHalf);
+                highHalf->setTwin(lowHalf);
+                added++;
+            }
+        }
+
+        if (added > 0) {
+            this->edgeCount += added;
+            this->markModified();
+        }
+        return added;
+        /* complejidad: o(b + min(n, b log b)) con b el tamaño del lote; marcar vecinos cuesta a lo sumo
+        hubDegreeThreshold por grupo porque los vértices de grado alto consultan su índice hash */
+    }
+
 protected:
     /*
      * @brief Implementación específica para copiar las aristas de otro grafo no dirigido a este.
-     * Utiliza el mapa de nodos para establecer las conexiones correctas en el nuevo grafo.
+     * Los vértices ya fueron copiados con los mismos índices, así que cada extremo se resuelve
+     * directamente en indexToNode. Las listas se copian en el mismo orden (agregando al final) y
+     * las mitades gemelas se emparejan sin mapas: al copiar la mitad u -> v con índice(u) < índice(v)
+     * se deja pendiente en el grupo de v; al copiar v, sus pendientes se vuelcan en un arreglo
+     * indexado por u y cada mitad v -> u encuentra su gemela en O(1). Costo total O(V + E).
      *
      * @param otherGraph El grafo no dirigido del cual se copiarán las aristas.
-     * @param nodeMap Un mapa que relaciona los nodos del grafo original con los nodos del nuevo grafo.
+     * @return false si otherGraph no es no dirigido o si falta memoria (la copia queda incompleta).
      */
-    virtual void copyEdges(const Graph<T>& otherGraph,
-                           const std::map<VertexNode<T>*, VertexNode<T>*>& nodeMap) {
+    virtual bool copyEdges(const Graph<T, W>& otherGraph) {
         /* Realiza un downcast seguro al tipo NonDirectedGraph. */
-        const NonDirectedGraph<T>* otherNonDirected = dynamic_cast<const NonDirectedGraph<T>*>(&otherGraph);
-        if (otherNonDirected) {
-            /* Recorre los vértices del grafo original. */
-            VertexNode<T>* currentOtherVertex = otherNonDirected->firstNode;
-            while (currentOtherVertex != NULL) {
-                /* Busca el nodo correspondiente en el nuevo grafo. */
-                typename std::map<VertexNode<T>*, VertexNode<T>*>::const_iterator it = nodeMap.find(currentOtherVertex);
-                if (it != nodeMap.end()) {
-                    VertexNode<T>* currentNewVertex = it->second;
-                    /* Recorre los nodos adyacentes del vértice original. */
-                    AdjacentNode<T>* currentOtherAdjacent = currentOtherVertex->getNextAdjacent();
-                    while (currentOtherAdjacent != NULL) {
-                        /* Busca el nodo adyacente correspondiente en el nuevo grafo. */
-                        typename std::map<VertexNode<T>*, VertexNode<T>*>::const_iterator adjacentIt = nodeMap.find(currentOtherAdjacent->getData());
-                        if (adjacentIt != nodeMap.end()) {
-                            VertexNode<T>* adjacentNewVertex = adjacentIt->second;
-                            double weight = currentOtherAdjacent->getWeight();
-                            /* Agrega la arista en el nuevo grafo (solo si no existe ya). */
-                            if (!this->findAdjacent(currentNewVertex, adjacentNewVertex->getData())) {
-                                AdjacentNode<T>* newAdjacent = new (std::nothrow) AdjacentNode<T>(adjacentNewVertex, weight);
-                                if (newAdjacent) {
-                                    newAdjacent->setNext(currentNewVertex->getNextAdjacent());
-                                    currentNewVertex->setNextAdjacent(newAdjacent);
-                                    /* Para grafos no dirigidos, la arista ya se habrá agregado desde el otro extremo. */
-                                    /* Evitamos doble conteo aquí. */
-                                }
-                            }
-                        }
-                        currentOtherAdjacent = currentOtherAdjacent->getNext();
-                    }
+        const NonDirectedGraph<T, W>* otherNonDirected = dynamic_cast<const NonDirectedGraph<T, W>*>(&otherGraph);
+        if (!otherNonDirected) return false;
+        const std::vector<VertexNode<T, W>*>& otherNodes = otherNonDirected->indexToNode;
+        int slots = static_cast<int>(otherNodes.size());
+
+        /* 1. Cuenta, para cada vértice v, cuántas mitades llegan desde vecinos de menor índice. */
+        std::vector<int> pendingStart(slots + 1, 0);
+        for (int u = 0; u < slots; u++) {
+            if (otherNodes[u] == NULL) continue;
+            for (AdjacentNode<T, W>* adj = otherNodes[u]->getNextAdjacent(); adj != NULL; adj = adj->getNext()) {
+                int v = adj->getData()->getIndex();
+                if (v > u) pendingStart[v + 1]++;
+            }
+        }
+        for (int v = 0; v < slots; v++) {
+            pendingStart[v + 1] += pendingStart[v];
+        }
+        std::vector<int> pendingSource(pendingStart[slots]);
+        std::vector<AdjacentNode<T, W>*> pendingCopy(pendingStart[slots]);
+        std::vector<int> pendingCursor(pendingStart.begin(), pendingStart.end() - 1);
+        std::vector<AdjacentNode<T, W>*> twinOf(slots, NULL);
+
+        /* 2. Copia cada lista en orden de índice, emparejando las gemelas. */
+        for (int u = 0; u < slots; u++) {
+            if (otherNodes[u] == NULL) continue;
+            VertexNode<T, W>* newVertex = this->indexToNode[u];
+            /* vuelca las mitades pendientes hacia u, indexadas por su vértice de origen */
+            for (int k = pendingStart[u]; k < pendingStart[u + 1]; k++) {
+                twinOf[pendingSource[k]] = pendingCopy[k];
+            }
+            AdjacentNode<T, W>* tail = NULL;
+            AdjacentNode<T, W>* selfLoopHalf = NULL;
+            for (AdjacentNode<T, W>* adj = otherNodes[u]->getNextAdjacent(); adj != NULL; adj = adj->getNext()) {
+                int v = adj->getData()->getIndex();
+                AdjacentNode<T, W>* newAdjacent = this->createAdjacentNode(this->indexToNode[v], adj->getWeight());
+                if (!newAdjacent) return false; /* sin memoria: la copia queda incompleta */
+                this->appendAdjacent(newVertex, newAdjacent, tail);
+                AdjacentNode<T, W>* twin = NULL;
+                if (v > u) {
+                    /* la gemela se creará al copiar v */
+                    pendingSource[pendingCursor[v]] = u;
+                    pendingCopy[pendingCursor[v]++] = newAdjacent;
+                } else if (v < u) {
+                    twin = twinOf[v];
+                } else if (selfLoopHalf == NULL) {
+                    /* primera mitad de un lazo: su gemela está más adelante en esta misma lista */
+                    selfLoopHalf = newAdjacent;
+                } else {
+                    twin = selfLoopHalf;
+                    selfLoopHalf = NULL;
+                }
+                if (twin != NULL) {
+                    twin->setTwin(newAdjacent);
+                    newAdjacent->setTwin(twin);
+                }
+            }
+        }
+        /* El contador de aristas se copia aparte, evitamos doble conteo aquí. */
+        return true;
+    }
+
+    /*
+     * @brief Identifica a los grafos no dirigidos en los archivos de instantánea.
+     */
+    virtual unsigned int snapshotKind() const { return SNAPSHOT_NON_DIRECTED; }
+
+    /*
+     * @brief Reconstruye las aristas desde la adyacencia CSR de un archivo.
+     * Cada arista aparece en la fila de sus dos extremos: se crea al encontrarla en la fila del menor
+     * índice, con las dos mitades gemelas a la vez. Un lazo aparece dos veces en su propia fila y se
+     * crea con la primera. Las filas están ordenadas, así que cada lista queda ordenada por índice.
+     *
+     * @param view La adyacencia leída del archivo.
+     * @return false si falta memoria (la restauración queda incompleta).
+     */
+    virtual bool restoreEdges(const CsrView& view) {
+        int slots = view.getVertexSlots();
+        std::vector<AdjacentNode<T, W>*> tails(slots, NULL);
+        for (int u = 0; u < slots; u++) {
+            VertexNode<T, W>* source = this->indexToNode[u];
+            if (source == NULL) continue;
+            bool loopPending = false;
+            for (int e = view.edgeBegin(u); e < view.edgeEnd(u); e++) {
+                int v = view.target(e);
+                if (v < u) continue; /* creada al recorrer la fila de v */
+                if (v == u) {
+                    loopPending = !loopPending;
+                    if (!loopPending) continue; /* segunda aparición del lazo */
+                }
+                AdjacentNode<T, W>* half = this->createAdjacentNode(this->indexToNode[v], W(view.weight(e)));
+                AdjacentNode<T, W>* twin = this->createAdjacentNode(source, W(view.weight(e)));
+                if (!half || !twin) {
+                    /* sin memoria: la restauración queda incompleta */
+                    this->destroyAdjacentNode(half);
+                    this->destroyAdjacentNode(twin);
+                    return false;
                 }
-                currentOtherVertex = currentOtherVertex->getNextVertex();
+                this->appendAdjacent(source, half, tails[u]);
+                this->appendAdjacent(this->indexToNode[v], twin, tails[v]);
+                half->setTwin(twin);
+                twin->setTwin(half);
             }
-            /* El contador de aristas se copia directamente en el constructor de copia de Graph. */
         }
+        return true;
     }
 
 private:
     /*
-     * @brief Método auxiliar privado para eliminar una arista entre un vértice de origen y un vértice de destino.
-     * Recorre la lista de adyacencia del vértice de origen y elimina el nodo adyacente al destino.
+     * @brief Arista de un lote de carga masiva expresada con índices internos.
+     */
+    struct BatchEdge {
+        int low; /* menor índice de los extremos */
+        int high; /* mayor índice de los extremos */
+        W weight; /* peso de la arista */
+    };
+
+    /*
+     * @brief Orden de las aristas de un lote por su menor índice.
+     */
+    struct BatchEdgeOrder {
+        bool operator()(const BatchEdge& first, const BatchEdge& second) const { return first.low < second.low; }
+    };
+
+    std::vector<unsigned long> batchMark; /* sello del último grupo de addEdges que marcó cada índice */
+    unsigned long batchStamp; /* último sello usado por addEdges */
+
+    /*
+     * @brief Método auxiliar privado para eliminar las dos mitades de una arista.
+     * Desenlaza la mitad indicada de la lista del origen y su gemela de la lista del destino,
+     * ambas en O(1) gracias a las listas doblemente enlazadas.
      *
-     * @param sourceVertex El nodo del vértice de origen.
-     * @param destinationVertex El nodo del vértice de destino.
-     * @return true si la arista fue eliminada, false si no se encontró.
+     * @param source El nodo del vértice de origen, propietario de la mitad.
+     * @param half La mitad de la arista almacenada en la lista de adyacencia del origen.
+     * @return true si la arista fue eliminada, false si los parámetros no son válidos.
      */
-    bool removeEdgeInternal(VertexNode<T>* source, VertexNode<T>* destination) {
-        if (!source || !destination) {
+    bool removeEdgeInternal(VertexNode<T, W>* source, AdjacentNode<T, W>* half) {
+        if (!source || !half) {
             return false;
         }
 
-        AdjacentNode<T>* prev = NULL;
-        AdjacentNode<T>* current = source->getNextAdjacent();
-
-        while (current != NULL) {
-            if (current->getData() == destination) {
-                if (prev == NULL) {
-                    source->setNextAdjacent(current->getNext());
-                } else {
-                    prev->setNext(current->getNext());
-                }
-                delete current;
-                return true;
-            }
-            prev = current;
-            current = current->getNext();
+        AdjacentNode<T, W>* twin = half->getTwin();
+        this->unlinkAdjacent(source, half);
+        if (twin != NULL) {
+            this->unlinkAdjacent(half->getData(), twin);
+            this->destroyAdjacentNode(twin);
         }
-        return false;
+        this->destroyAdjacentNode(half);
+        return true;
     }
 };
 
@@ -0,0 +1,254 @@
+#ifndef HASHMAP_H
+#define HASHMAP_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/* mezcla los bits de un valor entero para dispersarlo en la tabla (finalizador de murmurhash3) */
+inline std::size_t hashMix(std::size_t value) {
+    value ^= value >> 16;
+    value *= static_cast<std::size_t>(0x85ebca6bUL);
+    value ^= value >> 13;
+    value *= static_cast<std::size_t>(0xc2b2ae35UL);
+    value ^= value >> 16;
+    return value;
+    /* complejidad: o(1) */
+}
+
+/* fnv-1a sobre los bytes de un objeto */
+inline std::size_t hashBytes(const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    std::size_t hash = static_cast<std::size_t>(2166136261UL); /* base de fnv-1a */
+    for (std::size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= static_cast<std::size_t>(16777619UL); /* primo de fnv-1a */
+    }
+    return hashMix(hash);
+    /* complejidad: o(size) */
+}
+
+/* funcion hash generica: recorre los bytes del objeto con fnv-1a
+NOTA: la tabla compara las claves con operator==, asi que dos claves iguales deben tener los mismos bytes.
+solo es correcta para tipos sin memoria dinamica y sin bytes de relleno (enteros, punteros, estructuras cuyos
+campos ocupan todo su tamaño); los reales tienen su propia especializacion porque 0.0 == -0.0 con bytes distintos.
+los tipos que administran memoria propia o que tienen relleno deben especializar HashFunction */
+template <typename T>
+struct HashFunction {
+    std::size_t operator()(const T& value) const {
+        return hashBytes(&value, sizeof(T));
+        /* complejidad: o(sizeof(T)) */
+    }
+};
+
+/* funcion hash para tipos enteros: convierte el valor y lo mezcla */
+template <typename T>
+struct IntegralHashFunction {
+    std::size_t operator()(const T& value) const {
+        return hashMix(static_cast<std::size_t>(value));
+        /* complejidad: o(1) */
+    }
+};
+
+template <> struct HashFunction<char> : IntegralHashFunction<char> {};
+template <> struct HashFunction<signed char> : IntegralHashFunction<signed char> {};
+template <> struct HashFunction<unsigned char> : IntegralHashFunction<unsigned char> {};
+template <> struct HashFunction<short> : IntegralHashFunction<short> {};
+template <> struct HashFunction<unsigned short> : IntegralHashFunction<unsigned short> {};
+template <> struct HashFunction<int> : IntegralHashFunction<int> {};
+template <> struct HashFunction<unsigned int> : IntegralHashFunction<unsigned int> {};
+template <> struct HashFunction<long> : IntegralHashFunction<long> {};
+template <> struct HashFunction<unsigned long> : IntegralHashFunction<unsigned long> {};
+
+/* funcion hash para reales: -0.0 se normaliza a 0.0 para que las claves iguales den el mismo hash
+(un NaN nunca es igual a si mismo, asi que como clave no se vuelve a encontrar) */
+template <>
+struct HashFunction<double> {
+    std::size_t operator()(const double& value) const {
+        double normalized = value == 0.0 ? 0.0 : value;
+        return hashBytes(&normalized, sizeof(normalized));
+        /* complejidad: o(1) */
+    }
+};
+
+template <>
+struct HashFunction<float> {
+    std::size_t operator()(const float& value) const {
+        float normalized = value == 0.0f ? 0.0f : value;
+        return hashBytes(&normalized, sizeof(normalized));
+        /* complejidad: o(1) */
+    }
+};
+
+/* long double suele tener bytes de relleno: se resume como double, que conserva la igualdad
+(dos valores iguales dan el mismo double; valores distintos pueden colisionar) */
+template <>
+struct HashFunction<long double> {
+    std::size_t operator()(const long double& value) const {
+        return HashFunction<double>()(static_cast<double>(value));
+        /* complejidad: o(1) */
+    }
+};
+
+/* funcion hash para punteros: usa la direccion de memoria */
+template <typename T>
+struct HashFunction<T*> {
+    std::size_t operator()(T* const& value) const {
+        return hashMix(reinterpret_cast<std::size_t>(value));
+        /* complejidad: o(1) */
+    }
+};
+
+/* funcion hash para cadenas: fnv-1a sobre los caracteres */
+template <>
+struct HashFunction<std::string> {
+    std::size_t operator()(const std::string& value) const {
+        std::size_t hash = static_cast<std::size_t>(2166136261UL);
+        for (std::string::size_type i = 0; i < value.size(); i++) {
+            hash ^= static_cast<unsigned char>(value[i]);
+            hash *= static_cast<std::size_t>(16777619UL);
+        }
+        return hashMix(hash);
+        /* complejidad: o(longitud de la cadena) */
+    }
+};
+
+/* tabla hash de direccionamiento abierto con sondeo lineal y borrado por desplazamiento hacia atras
+(no deja lapidas, por lo que las busquedas no se degradan con las eliminaciones) */
+template <typename K, typename V, typename H = HashFunction<K> >
+class HashMap {
+private:
+    /* casilla de la tabla */
+    struct Slot {
+        K key; /* clave almacenada */
+        V value; /* valor asociado a la clave */
+        bool used; /* indica si la casilla esta ocupada */
+        Slot() : key(K()), value(V()), used(false) {}
+    };
+
+    std::vector<Slot> slots; /* arreglo de casillas, su tamaño siempre es potencia de dos */
+    std::size_t count; /* numero de claves almacenadas */
+    H hasher; /* funcion hash utilizada */
+
+    /* posicion inicial de una clave en la tabla */
+    std::size_t homeOf(const K& key) const {
+        return hasher(key) & (slots.size() - 1);
+    }
+
+    /* busca la casilla de una clave, devuelve slots.size() si no existe */
+    std::size_t locate(const K& key) const {
+        if (slots.empty()) return 0;
+        std::size_t mask = slots.size() - 1;
+        std::size_t pos = homeOf(key);
+        while (slots[pos].used) {
+            if (slots[pos].key == key) return pos;
+            pos = (pos + 1) & mask;
+        }
+        return slots.size();
+        /* complejidad promedio: o(1) */
+        /* complejidad peor caso: o(n) */
+    }
+
+    /* redimensiona la tabla a una nueva capacidad (potencia de dos) y reinserta las claves */
+    void rehash(std::size_t newCapacity) {
+        std::vector<Slot> old;
+        old.swap(slots);
+        slots.resize(newCapacity);
+        std::size_t mask = newCapacity - 1;
+        for (std::size_t i = 0; i < old.size(); i++) {
+            if (old[i].used) {
+                std::size_t pos = hasher(old[i].key) & mask;
+                while (slots[pos].used) pos = (pos + 1) & mask;
+                slots[pos] = old[i];
+            }
+        }
+        /* complejidad: o(capacidad) */
+    }
+
+    /* mantiene el factor de carga por debajo de 1/2 para un numero de claves dado */
+    void growFor(std::size_t keys) {
+        std::size_t capacity = slots.empty() ? 16 : slots.size();
+        while (keys * 2 > capacity) capacity *= 2;
+        if (capacity != slots.size()) rehash(capacity);
+    }
+
+public:
+    HashMap() : count(0) {}
+
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    /* reserva espacio para un numero de claves y evita redimensionamientos posteriores */
+    void reserve(std::size_t keys) {
+        growFor(keys);
+    }
+
+    /* devuelve un puntero al valor asociado a la clave, o NULL si la clave no existe */
+    V* find(const K& key) {
+        std::size_t pos = locate(key);
+        return pos < slots.size() ? &slots[pos].value : NULL;
+        /* complejidad promedio: o(1) */
+    }
+
+    const V* find(const K& key) const {
+        std::size_t pos = locate(key);
+        return pos < slots.size() ? &slots[pos].value : NULL;
+        /* complejidad promedio: o(1) */
+    }
+
+    bool contains(const K& key) const {
+        return find(key) != NULL;
+    }
+
+    /* inserta la clave con su valor; si la clave ya existe solo actualiza el valor
+    retorna true si la clave era nueva */
+    bool insert(const K& key, const V& value) {
+        growFor(count + 1);
+        std::size_t mask = slots.size() - 1;
+        std::size_t pos = homeOf(key);
+        while (slots[pos].used) {
+            if (slots[pos].key == key) {
+                slots[pos].value = value;
+                return false;
+            }
+            pos = (pos + 1) & mask;
+        }
+        slots[pos].key = key;
+        slots[pos].value = value;
+        slots[pos].used = true;
+        count++;
+        return true;
+        /* complejidad promedio: o(1) amortizado */
+    }
+
+    /* elimina la clave, retorna true si existia */
+    bool erase(const K& key) {
+        std::size_t hole = locate(key);
+        if (hole >= slots.size()) return false;
+        std::size_t mask = slots.size() - 1;
+        std::size_t pos = (hole + 1) & mask;
+        /* desplaza hacia atras las claves del mismo grupo para no romper las cadenas de sondeo */
+        while (slots[pos].used) {
+            std::size_t home = homeOf(slots[pos].key);
+            /* la clave puede ocupar el hueco si su posicion inicial no esta entre el hueco y su posicion actual */
+            if (((pos - home) & mask) >= ((pos - hole) & mask)) {
+                slots[hole] = slots[pos];
+                hole = pos;
+            }
+            pos = (pos + 1) & mask;
+        }
+        slots[hole] = Slot();
+        count--;
+        return true;
+        /* complejidad promedio: o(1) */
+    }
+
+    /* elimina todas las claves y libera la memoria de la tabla */
+    void clear() {
+        std::vector<Slot>().swap(slots);
+        count = 0;
+        /* complejidad: o(capacidad) */
+    }
+};
+
+#endif
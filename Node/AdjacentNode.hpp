@@ -1,49 +1,67 @@
 #ifndef ADJACENTNODE_H
 #define ADJACENTNODE_H
 #include <cstddef>
+#include "EdgeWeight.hpp"
 
-template <typename T> class VertexNode;
+template <typename T, typename W> class VertexNode;
 
-template <typename T> class AdjacentNode{
+/* el peso de la arista hacia el vertice almacenado (su costo) se guarda en la base WeightSlot<W>:
+con W = UnitWeight no ocupa memoria */
+template <typename T, typename W = double> class AdjacentNode : private WeightSlot<W> {
 
-double weight; /* peso de la arista hacia el vertice almacenado, tambien conocido como su costo */
-VertexNode<T>* data; /* puntero al vertice adyacente, indica con cual nodo forma una arista este objeto*/
-AdjacentNode<T>* next;/* puntero al siguiente nodo adyacente, emula comportamiento de una lista */
+VertexNode<T, W>* data; /* puntero al vertice adyacente, indica con cual nodo forma una arista este objeto*/
+AdjacentNode<T, W>* next;/* puntero al siguiente nodo adyacente, emula comportamiento de una lista */
+AdjacentNode<T, W>* prev;/* puntero al nodo adyacente anterior, permite desenlazar el nodo en o(1) */
+AdjacentNode<T, W>* twin;/* puntero a la otra mitad de la arista (la entrada inversa en la lista del vertice adyacente) */
 
 public:
 
     /* constructores publicos de la clase: permiten instanciar un objeto desde determinadas condiciones */
-    AdjacentNode() : weight(0.0), data(NULL), next(NULL){}; /* constructor predeterminado, sirve para construir un nodo nuevo vacio*/
-    AdjacentNode(VertexNode<T> *newData, double newWeight)
-      : weight(newWeight), data(newData), next(NULL){};
+    AdjacentNode() : WeightSlot<W>(), data(NULL), next(NULL), prev(NULL), twin(NULL){}; /* constructor predeterminado, sirve para construir un nodo nuevo vacio*/
+    AdjacentNode(VertexNode<T, W> *newData, const W& newWeight)
+      : WeightSlot<W>(newWeight), data(newData), next(NULL), prev(NULL), twin(NULL){};
 
     /* destructor: no elimina la data porque es un apuntador a un vertice perteneciente al grafo */
     ~AdjacentNode(){
         next = NULL;
+        prev = NULL;
+        twin = NULL;
     }
 
     /* metodos getters: permiten obtener los atributos privados */
-    double getWeight() const { return weight; };
-    VertexNode<T> *getData() const { return data; };
-    AdjacentNode<T> *getNext() const { return next; };
+    W getWeight() const { return WeightSlot<W>::getWeight(); };
+    VertexNode<T, W> *getData() const { return data; };
+    AdjacentNode<T, W> *getNext() const { return next; };
+    AdjacentNode<T, W> *getPrev() const { return prev; };
+    AdjacentNode<T, W> *getTwin() const { return twin; };
 
     /* metodos setters: permiten modificar los atributos privados 
     NOTA: incluye seguridad para evitar autoreferenciado */
-    void setWeight(double newWeight) {
-        if(newWeight >= 0){ /* evita la asignacion de un peso negativo */
-        weight = newWeight;
+    void setWeight(const W& newWeight) {
+        if(static_cast<double>(newWeight) >= 0){ /* evita la asignacion de un peso negativo */
+        this->storeWeight(newWeight);
         }
     };
-    void setData(VertexNode<T> *newData){ 
+    void setData(VertexNode<T, W> *newData){ 
         if(data != newData){ /* evita la asignacion de un dato repetido */
         data = newData;
         }
     };
-    void setNext(AdjacentNode<T> * newNext) {
+    void setNext(AdjacentNode<T, W> * newNext) {
         if(newNext != next && newNext != this){ /* evita la re-asignacion y la auto-referencia */
         next = newNext;
         }
     };
+    void setPrev(AdjacentNode<T, W> * newPrev) {
+        if(newPrev != prev && newPrev != this){ /* evita la re-asignacion y la auto-referencia */
+        prev = newPrev;
+        }
+    };
+    void setTwin(AdjacentNode<T, W> * newTwin) {
+        if(newTwin != this){ /* evita la auto-referencia */
+        twin = newTwin;
+        }
+    };
 
 private:
     /* elimina las operaciones de copia para prevenir un uso incorrecto de memoria e incorrecto manejo de punteros*/
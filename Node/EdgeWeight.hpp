@@ -0,0 +1,53 @@
+#ifndef EDGEWEIGHT_H
+#define EDGEWEIGHT_H
+
+/* tipos y utilidades para el peso de las aristas (parametro W de los grafos y nodos)
+W puede ser cualquier tipo aritmetico (double, float, int, unsigned char, ...) o UnitWeight; se construye
+desde un double y se convierte a double, que es como se exponen los pesos en las instantaneas csr */
+
+/* peso unitario para grafos sin pesos: no guarda nada y siempre vale 1 */
+struct UnitWeight {
+    UnitWeight() {}
+    UnitWeight(double) {} /* cualquier peso se descarta */
+    operator double() const { return 1.0; }
+};
+
+/* almacenamiento del peso dentro de un nodo; los nodos heredan de esta clase para que la especializacion
+de UnitWeight, que no tiene atributos, no ocupe memoria (optimizacion de base vacia) */
+template <typename W>
+class WeightSlot {
+    W weight; /* peso guardado */
+
+public:
+    WeightSlot() : weight(W()) {}
+    explicit WeightSlot(const W& newWeight) : weight(newWeight) {}
+    W getWeight() const { return weight; }
+    void storeWeight(const W& newWeight) { weight = newWeight; }
+};
+
+template <>
+class WeightSlot<UnitWeight> {
+public:
+    WeightSlot() {}
+    explicit WeightSlot(const UnitWeight&) {}
+    UnitWeight getWeight() const { return UnitWeight(); }
+    void storeWeight(const UnitWeight&) {}
+};
+
+/* resultado de una consulta de peso: indica si la arista existe en lugar de devolver un valor especial */
+template <typename W>
+class OptionalWeight : private WeightSlot<W> {
+    bool present; /* indica si la arista existe */
+
+public:
+    OptionalWeight() : WeightSlot<W>(), present(false) {}
+    explicit OptionalWeight(const W& newWeight) : WeightSlot<W>(newWeight), present(true) {}
+
+    bool found() const { return present; }
+    /* peso de la arista; solo tiene sentido si found() es true */
+    W value() const { return this->getWeight(); }
+    /* peso de la arista, o fallback si no existe */
+    W valueOr(const W& fallback) const { return present ? this->getWeight() : fallback; }
+};
+
+#endif
@@ -0,0 +1,108 @@
+#ifndef NODEPOOL_H
+#define NODEPOOL_H
+
+#include <cstddef>
+#include <new> /* para operator new con nothrow y new de ubicacion */
+#include <vector>
+
+/* asignador por bloques (slabs) para nodos de un mismo tipo
+reserva memoria en bloques de tamaño creciente, reutiliza los nodos liberados mediante una lista libre
+y permite liberar todos los bloques de una vez sin visitar cada nodo
+NOTA: el pool solo administra memoria; quien construye un nodo con new de ubicacion debe destruirlo
+con destroy() (o invocar su destructor antes de releaseAll() si el nodo lo necesita) */
+template <typename N>
+class NodePool {
+private:
+    /* celda de memoria: almacena un nodo o, si esta libre, el enlace al siguiente libre */
+    union Cell {
+        char storage[sizeof(N)]; /* espacio para el nodo */
+        Cell* nextFree; /* enlace de la lista libre */
+        double alignDouble; /* fuerzan la alineacion de la celda */
+        void* alignPointer;
+        long alignLong;
+    };
+
+    std::vector<Cell*> slabs; /* bloques reservados */
+    Cell* freeList; /* primera celda libre reutilizable */
+    Cell* cursor; /* siguiente celda sin usar del bloque actual */
+    Cell* slabEnd; /* fin del bloque actual */
+    std::size_t nextSlabSize; /* numero de celdas del proximo bloque */
+    unsigned long requests; /* numero de nodos solicitados (equivale a las llamadas a new sin el pool) */
+    int liveNodes; /* nodos actualmente en uso */
+
+    static const std::size_t firstSlabSize = 64; /* celdas del primer bloque */
+    static const std::size_t maxSlabSize = 65536; /* limite de celdas por bloque */
+
+    /* reserva un bloque nuevo, retorna false si no hay memoria */
+    bool grow() {
+        Cell* slab = static_cast<Cell*>(::operator new(nextSlabSize * sizeof(Cell), std::nothrow));
+        if (!slab) return false;
+        slabs.push_back(slab);
+        cursor = slab;
+        slabEnd = slab + nextSlabSize;
+        /* duplica el tamaño del siguiente bloque hasta el limite */
+        if (nextSlabSize < maxSlabSize) nextSlabSize *= 2;
+        return true;
+    }
+
+    /* prohibe la copia: los bloques pertenecen a un unico pool */
+    NodePool(const NodePool&);
+    NodePool& operator=(const NodePool&);
+
+public:
+    NodePool() : freeList(NULL), cursor(NULL), slabEnd(NULL), nextSlabSize(firstSlabSize), requests(0), liveNodes(0) {}
+
+    ~NodePool() {
+        releaseAll();
+    }
+
+    /* entrega memoria para un nodo (sin construirlo), o NULL si no hay memoria */
+    void* allocate() {
+        Cell* cell;
+        if (freeList != NULL) {
+            /* reutiliza una celda liberada */
+            cell = freeList;
+            freeList = freeList->nextFree;
+        } else {
+            /* toma la siguiente celda del bloque actual, reservando otro bloque si se agoto */
+            if (cursor == slabEnd && !grow()) return NULL;
+            cell = cursor++;
+        }
+        requests++;
+        liveNodes++;
+        return cell->storage;
+        /* complejidad: o(1) amortizado */
+    }
+
+    /* destruye un nodo y devuelve su celda a la lista libre */
+    void destroy(N* node) {
+        if (node == NULL) return;
+        node->~N();
+        Cell* cell = reinterpret_cast<Cell*>(node);
+        cell->nextFree = freeList;
+        freeList = cell;
+        liveNodes--;
+        /* complejidad: o(1) */
+    }
+
+    /* libera todos los bloques sin recorrer los nodos: o(numero de bloques)
+    los destructores de los nodos que sigan vivos no se ejecutan */
+    void releaseAll() {
+        for (std::size_t i = 0; i < slabs.size(); i++) {
+            ::operator delete(slabs[i]);
+        }
+        slabs.clear();
+        freeList = NULL;
+        cursor = slabEnd = NULL;
+        nextSlabSize = firstSlabSize;
+        liveNodes = 0;
+        /* complejidad: o(numero de bloques) */
+    }
+
+    /* estadisticas del pool */
+    int getSlabCount() const { return static_cast<int>(slabs.size()); } /* reservas reales de memoria */
+    unsigned long getRequestCount() const { return requests; } /* nodos solicitados en total */
+    int getLiveCount() const { return liveNodes; } /* nodos en uso */
+};
+
+#endif
@@ -2,25 +2,41 @@
 #define NODOVERT_H
 
 #include "AdjacentNode.hpp"
+#include "../Hash/HashMap.hpp"
 
-template <typename T> class VertexNode{
+template <typename T, typename W = double> class VertexNode{
 
     T data; /* dato contenido por el grafo */
-    VertexNode<T>* nextVertex; /* puntero al siguiente nodo vertice */
-    AdjacentNode<T>* nextAdjacent; /* puntero al primer nodo adyacente */
+    VertexNode<T, W>* nextVertex; /* puntero al siguiente nodo vertice */
+    VertexNode<T, W>* prevVertex; /* puntero al nodo vertice anterior, permite desenlazar el vertice en o(1) */
+    AdjacentNode<T, W>* nextAdjacent; /* puntero al primer nodo adyacente */
+    AdjacentNode<T, W>* nextIncoming; /* puntero al primer nodo de la lista de aristas entrantes (solo grafos dirigidos) */
+    int index; /* indice interno del vertice dentro del grafo, -1 si no esta registrado */
+    int degree; /* numero de nodos en la lista de adyacencia */
+    HashMap<VertexNode<T, W>*, AdjacentNode<T, W>*>* adjacencyIndex; /* indice hash destino -> nodo adyacente, solo para vertices de grado alto */
 
 public:
     /* constructores publicos de la clase: permiten instanciar un objeto desde determinadas condiciones */
-    VertexNode() : data( T() ), nextVertex(NULL), nextAdjacent(NULL){};
-    VertexNode(T newData) : data(newData), nextVertex(NULL), nextAdjacent(NULL){};
-    VertexNode(T newData, VertexNode<T>* newNextVertex): data(newData), nextVertex(newNextVertex), nextAdjacent(NULL){};
-    VertexNode(T newData,AdjacentNode<T>* nextAdjacent): data(newData), nextVertex(NULL), nextAdjacent(nextAdjacent){};
-    VertexNode(T newData,VertexNode<T>* newNextVertex,AdjacentNode<T>* nextAdjacent): data(newData), nextVertex(newNextVertex), nextAdjacent(nextAdjacent){};
+    VertexNode() : data( T() ), nextVertex(NULL), prevVertex(NULL), nextAdjacent(NULL), nextIncoming(NULL), index(-1), degree(0), adjacencyIndex(NULL){};
+    VertexNode(T newData) : data(newData), nextVertex(NULL), prevVertex(NULL), nextAdjacent(NULL), nextIncoming(NULL), index(-1), degree(0), adjacencyIndex(NULL){};
+    VertexNode(T newData, VertexNode<T, W>* newNextVertex): data(newData), nextVertex(newNextVertex), prevVertex(NULL), nextAdjacent(NULL), nextIncoming(NULL), index(-1), degree(0), adjacencyIndex(NULL){};
+    VertexNode(T newData,AdjacentNode<T, W>* nextAdjacent): data(newData), nextVertex(NULL), prevVertex(NULL), nextAdjacent(nextAdjacent), nextIncoming(NULL), index(-1), degree(0), adjacencyIndex(NULL){};
+    VertexNode(T newData,VertexNode<T, W>* newNextVertex,AdjacentNode<T, W>* nextAdjacent): data(newData), nextVertex(newNextVertex), prevVertex(NULL), nextAdjacent(nextAdjacent), nextIncoming(NULL), index(-1), degree(0), adjacencyIndex(NULL){};
 
     /* metodos getters: permiten obtener los atributos privados */
     const T& getData() const { return data; }; 
-    VertexNode<T> *getNextVertex() const { return nextVertex; };
-    AdjacentNode<T> *getNextAdjacent() const { return nextAdjacent; };
+    VertexNode<T, W> *getNextVertex() const { return nextVertex; };
+    VertexNode<T, W> *getPrevVertex() const { return prevVertex; };
+    AdjacentNode<T, W> *getNextAdjacent() const { return nextAdjacent; };
+    AdjacentNode<T, W> *getNextIncoming() const { return nextIncoming; };
+    int getIndex() const { return index; };
+    int getDegree() const { return degree; };
+    HashMap<VertexNode<T, W>*, AdjacentNode<T, W>*>* getAdjacencyIndex() const { return adjacencyIndex; };
+
+    /* destructor: libera el indice hash de adyacencia si existe (los nodos adyacentes pertenecen al grafo) */
+    ~VertexNode(){
+        delete adjacencyIndex;
+    }
 
     /* metodos setters: permiten modificar los atributos privados 
     NOTA: incluye seguridad para evitar autoreferenciado */
@@ -29,16 +45,34 @@ public:
         data = newData;
         }
     };
-    void setNextVertex(VertexNode<T> *newNextVertex){ 
+    void setNextVertex(VertexNode<T, W> *newNextVertex){ 
         if(newNextVertex != nextVertex && newNextVertex != this){
         nextVertex = newNextVertex;
         }
     };
-    void setNextAdjacent(AdjacentNode<T> *newNextAdjacent){ 
+    void setPrevVertex(VertexNode<T, W> *newPrevVertex){ 
+        if(newPrevVertex != prevVertex && newPrevVertex != this){
+        prevVertex = newPrevVertex;
+        }
+    };
+    void setNextAdjacent(AdjacentNode<T, W> *newNextAdjacent){ 
         if(newNextAdjacent != nextAdjacent){
         nextAdjacent = newNextAdjacent; 
         }
     };
+    void setNextIncoming(AdjacentNode<T, W> *newNextIncoming){ 
+        if(newNextIncoming != nextIncoming){
+        nextIncoming = newNextIncoming; 
+        }
+    };
+    void setIndex(int newIndex){ index = newIndex; };
+    void setDegree(int newDegree){ degree = newDegree; };
+    void setAdjacencyIndex(HashMap<VertexNode<T, W>*, AdjacentNode<T, W>*>* newIndex){ 
+        if(newIndex != adjacencyIndex){
+        delete adjacencyIndex; /* reemplazar el indice libera el anterior */
+        adjacencyIndex = newIndex;
+        }
+    };
 
 private:
     /* elimina las operaciones de copia para prevenir un uso incorrecto de memoria e incorrecto manejo de punteros*/
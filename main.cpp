@@ -1,92 +1,2584 @@
-#include "Graphs/NonDirectedGraph.hpp"
-#include <iostream>
-#include <cassert>
-#include <cmath>
-#include <vector>
-#include <ctime> // Para medir el tiempo de ejecución
-
-using namespace std;
-
-// Función para medir el tiempo transcurrido en milisegundos (C++98)
-double getMilliseconds() {
-    clock_t start = clock();
-    return static_cast<double>(start) / (CLOCKS_PER_SEC / 1000.0);
-}
-
-int main() {
-    std::cout << "--- Prueba de Estrés de NonDirectedGraph con Muchos Nodos (C++98) ---" << std::endl;
-
-    NonDirectedGraph<int> graph;
-    int numVertices = 10000; // Número grande de vértices
-    int numAristas = 50000; // Número grande de aristas
-
-    // 1. Prueba de addVertex con muchos vértices
-    double start_time = getMilliseconds();
-    for (int i = 0; i < numVertices; ++i) {
-        graph.addVertex(i);
-        assert(graph.containsVertex(i));
-    }
-    double end_time = getMilliseconds();
-    cout << "1. addVertex con " << numVertices << " vértices: OK. Tiempo: " << end_time - start_time << " ms" << endl;
-    assert(graph.getVertexCount() == numVertices);
-
-    // 2. Prueba de addEdge con muchas aristas
-    start_time = getMilliseconds();
-    for (int i = 0; i < numAristas; ++i) {
-        int source = i % numVertices;         // Distribución simple de las aristas
-        int dest = (i + 1) % numVertices;     // para conectar vértices.
-        double weight = (i % 100) / 10.0; // Peso entre 0.0 y 9.9
-        graph.addEdge(source, dest, weight);
-        if (!graph.containsEdge(source,dest)){
-           cout << "ERROR: No se agrego la arista " << source << " <-> " << dest << endl;
-        }
-        assert(graph.containsEdge(source, dest));
-        assert(graph.containsEdge(dest, source));
-        assert(abs(graph.edgeWeight(source, dest) - weight) < 0.0001);
-        assert(abs(graph.edgeWeight(dest, source) - weight) < 0.0001);
-    }
-    end_time = getMilliseconds();
-    cout << "2. addEdge con " << numAristas << " aristas: OK. Tiempo: " << end_time - start_time << " ms" << endl;
-    assert(graph.getEdgeCount() == numAristas);
-
-    // 3. Prueba de removeEdge con muchas aristas
-    start_time = getMilliseconds();
-    for (int i = 0; i < numAristas / 2; ++i) { // Eliminar la mitad de las aristas
-        int source = i % numVertices;
-        int dest = (i + 1) % numVertices;
-        if (graph.containsEdge(source, dest)) { // Importante verificar antes de eliminar
-            graph.removeEdge(source, dest);
-            assert(!graph.containsEdge(source, dest));
-            assert(!graph.containsEdge(dest, source));
-        }
-    }
-    end_time = getMilliseconds();
-    cout << "3. removeEdge con " << numAristas / 2 << " aristas: OK. Tiempo: " << end_time - start_time << " ms" << endl;
-    assert(graph.getEdgeCount() == numAristas - (numAristas / 2));
-
-    // 4. Prueba de removeVertex con muchos vértices
-    start_time = getMilliseconds();
-    for (int i = 0; i < numVertices / 2; ++i) { // Eliminar la mitad de los vértices
-        if (graph.containsVertex(i)) {
-            graph.removeVertex(i);
-            assert(!graph.containsVertex(i));
-        }
-    }
-    end_time = getMilliseconds();
-    cout << "4. removeVertex con " << numVertices / 2 << " vértices: OK. Tiempo: " << end_time - start_time << " ms" << endl;
-    assert(graph.getVertexCount() == numVertices - (numVertices / 2));
-
-    // 5. Prueba de clear
-    start_time = getMilliseconds();
-    graph.clear();
-    end_time = getMilliseconds();
-    cout << "5. clear: OK. Tiempo: " << end_time - start_time << " ms" << endl;
-    assert(graph.isEmpty());
-    assert(graph.getVertexCount() == 0);
-    assert(graph.getEdgeCount() == 0);
-
-    std::cout << "--- Fin de la Prueba de Estrés con Muchos Nodos (C++98) ---" << std::endl;
-
-    return 0;
-}
-
+#include "Graphs/NonDirectedGraph.hpp"
+#include "Graphs/DirectedGraph.hpp"
+#include "Graphs/DenseNonDirectedGraph.hpp"
+#include "Graphs/EdgeListLoader.hpp"
+#include "Graphs/Algorithms/BreadthFirstSearch.hpp"
+#include "Graphs/Algorithms/ShortestPaths.hpp"
+#include "Graphs/Algorithms/ConnectedComponents.hpp"
+#include "Graphs/Algorithms/PageRank.hpp"
+#include "Graphs/Algorithms/VertexOrdering.hpp"
+#include "Graphs/Algorithms/MultiSourceBfs.hpp"
+#include "Graphs/Algorithms/TriangleCounting.hpp"
+#include "Graphs/Algorithms/SpanningForest.hpp"
+#include "Graphs/Algorithms/Betweenness.hpp"
+#include "Graphs/Algorithms/MaxFlow.hpp"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <vector>
+#include <cstdio>
+#include <cstddef> // offsetof
+#include <fstream>
+#include <ctime> // Para medir el tiempo de ejecución
+
+using namespace std;
+
+// Generador congruencial lineal simple y reproducible para las pruebas con datos aleatorios.
+unsigned long siguienteAleatorio(unsigned long& estado) {
+    estado = estado * 1103515245UL + 12345UL;
+    return (estado >> 16) & 0x7fffffffUL;
+}
+
+// Función para medir el tiempo transcurrido en milisegundos (C++98)
+double getMilliseconds() {
+    clock_t start = clock();
+    return static_cast<double>(start) / (CLOCKS_PER_SEC / 1000.0);
+}
+
+// Prueba de rendimiento de addEdge sobre un grafo grande: con el índice hash de vértices
+// cada arista resuelve sus extremos en O(1), por lo que el tiempo crece linealmente.
+void pruebaAddEdgeMasivo() {
+    std::cout << "--- Prueba de Rendimiento de addEdge con el Índice Hash de Vértices ---" << std::endl;
+
+    NonDirectedGraph<int> graph;
+    int numVertices = 1000000;
+    int numAristas = 2000000;
+
+    double start_time = getMilliseconds();
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addVertex(i);
+    }
+    double end_time = getMilliseconds();
+    cout << "1. addVertex con " << numVertices << " vértices. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getVertexCount() == numVertices);
+
+    start_time = getMilliseconds();
+    for (int i = 0; i < numAristas; ++i) {
+        int source = i % numVertices;
+        int dest = (i + i / numVertices + 1) % numVertices;
+        graph.addEdge(source, dest, 1.0);
+    }
+    end_time = getMilliseconds();
+    double elapsed = end_time - start_time;
+    cout << "2. addEdge con " << numAristas << " aristas. Tiempo: " << elapsed << " ms";
+    if (elapsed > 0) {
+        cout << " (" << static_cast<long>(numAristas / (elapsed / 1000.0)) << " aristas/s)";
+    }
+    cout << endl;
+    assert(graph.getEdgeCount() == numAristas);
+    assert(graph.containsEdge(numVertices - 1, 0));
+    assert(graph.getIndexByData(numVertices - 1) == numVertices - 1);
+
+    std::cout << "--- Fin de la Prueba de Rendimiento de addEdge ---" << std::endl;
+}
+
+// Prueba de la instantánea CSR: congela el grafo, recorre vecinos sobre arreglos contiguos
+// y verifica que la instantánea se invalide con cualquier mutación.
+void pruebaInstantaneaCsr() {
+    std::cout << "--- Prueba de la Instantánea CSR (freeze) ---" << std::endl;
+
+    NonDirectedGraph<int> graph;
+    int numVertices = 100000;
+    int numAristas = 500000;
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addVertex(i);
+    }
+    for (int i = 0; i < numAristas; ++i) {
+        graph.addEdge(i % numVertices, (i + i / numVertices + 1) % numVertices, (i % 100) / 10.0);
+    }
+
+    // 1. Consultas por índice sin instantánea (recorren la lista de adyacencia)
+    double start_time = getMilliseconds();
+    double suma = 0.0;
+    for (int i = 1; i < numVertices - 3; ++i) {
+        suma += graph.edgeWeightByIndex(i, i + 3);
+    }
+    double end_time = getMilliseconds();
+    cout << "1. edgeWeightByIndex sin instantánea: Tiempo: " << end_time - start_time << " ms" << endl;
+
+    // 2. Construcción de la instantánea
+    start_time = getMilliseconds();
+    const CsrView& view = graph.freeze();
+    end_time = getMilliseconds();
+    cout << "2. freeze con " << view.getEntryCount() << " entradas: Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.isFrozen());
+    assert(view.getEntryCount() == 2 * numAristas);
+
+    // 3. Las mismas consultas sobre la instantánea deben dar el mismo resultado
+    start_time = getMilliseconds();
+    double sumaCsr = 0.0;
+    for (int i = 1; i < numVertices - 3; ++i) {
+        sumaCsr += graph.edgeWeightByIndex(i, i + 3);
+    }
+    end_time = getMilliseconds();
+    cout << "3. edgeWeightByIndex con instantánea: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(abs(suma - sumaCsr) < 0.0001);
+
+    // 4. Recorridos de vecinos repetidos sobre la instantánea
+    int pasadas = 20;
+    start_time = getMilliseconds();
+    long visitados = 0;
+    for (int p = 0; p < pasadas; ++p) {
+        for (int v = 0; v < view.getVertexSlots(); ++v) {
+            for (int e = view.edgeBegin(v); e < view.edgeEnd(v); ++e) {
+                visitados += view.target(e) >= 0 ? 1 : 0;
+            }
+        }
+    }
+    end_time = getMilliseconds();
+    cout << "4. " << pasadas << " recorridos completos de vecinos: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(visitados == static_cast<long>(pasadas) * 2 * numAristas);
+
+    // 5. Una mutación invalida la instantánea y freeze la reconstruye
+    unsigned long version = graph.getVersion();
+    graph.removeEdge(1, 2);
+    assert(!graph.isFrozen());
+    assert(graph.getVersion() != version);
+    assert(!graph.containsEdgeByIndex(1, 2));
+    const CsrView& rebuilt = graph.freeze();
+    assert(rebuilt.getEntryCount() == 2 * (numAristas - 1));
+    assert(!graph.containsEdgeByIndex(1, 2));
+    assert(graph.containsEdgeByIndex(1, 3));
+    cout << "5. invalidación tras mutación y reconstrucción: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba de la Instantánea CSR ---" << std::endl;
+}
+
+// Prueba de los pools de nodos: compara las asignaciones que haría new por cada nodo
+// con los bloques que reserva el pool, y mide la liberación en bloque de clear.
+void pruebaPoolNodos() {
+    std::cout << "--- Prueba de los Pools de Nodos (VertexNode / AdjacentNode) ---" << std::endl;
+
+    NonDirectedGraph<int> graph;
+    int numVertices = 200000;
+    int numAristas = 1000000;
+
+    double start_time = getMilliseconds();
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addVertex(i);
+    }
+    for (int i = 0; i < numAristas; ++i) {
+        graph.addEdge(i % numVertices, (i + i / numVertices + 1) % numVertices, 1.0);
+    }
+    double end_time = getMilliseconds();
+    cout << "1. construcción con " << numVertices << " vértices y " << numAristas << " aristas: Tiempo: " << end_time - start_time << " ms" << endl;
+    cout << "   asignaciones con new por nodo: " << graph.getNodeRequestCount()
+         << ", bloques reservados por los pools: " << graph.getSlabCount() << endl;
+    assert(graph.getNodeRequestCount() == static_cast<unsigned long>(numVertices + 2 * numAristas));
+
+    // 2. Eliminar y volver a agregar aristas reutiliza las celdas liberadas sin reservar bloques nuevos
+    int bloques = graph.getSlabCount();
+    start_time = getMilliseconds();
+    for (int i = 1; i < numVertices; ++i) {
+        graph.removeEdge(i, i + 1 < numVertices ? i + 1 : 0);
+    }
+    for (int i = 1; i < numVertices; ++i) {
+        graph.addEdge(i, i + 1 < numVertices ? i + 1 : 0, 2.0);
+    }
+    end_time = getMilliseconds();
+    cout << "2. reutilización de " << numVertices - 1 << " aristas eliminadas: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getSlabCount() == bloques);
+    assert(graph.getEdgeCount() == numAristas);
+
+    // 3. clear libera los nodos adyacentes por bloques
+    start_time = getMilliseconds();
+    graph.clear();
+    end_time = getMilliseconds();
+    cout << "3. clear: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.isEmpty());
+    assert(graph.getSlabCount() == 0);
+
+    std::cout << "--- Fin de la Prueba de los Pools de Nodos ---" << std::endl;
+}
+
+// Prueba de eliminación O(grado): cada arista guarda su mitad gemela, por lo que removeVertex
+// solo recorre las aristas del vértice eliminado. También valida lazos y grafos copiados.
+void pruebaEliminacionGemelas() {
+    std::cout << "--- Prueba de removeVertex O(grado) con Aristas Gemelas ---" << std::endl;
+
+    NonDirectedGraph<int> graph;
+    int numVertices = 200000;
+    int numAristas = 1000000;
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addVertex(i);
+    }
+    for (int i = 0; i < numAristas; ++i) {
+        graph.addEdge(i % numVertices, (i + i / numVertices + 1) % numVertices, 1.0);
+    }
+
+    // 1. Eliminar la mitad de los vértices cuesta la suma de sus grados
+    double start_time = getMilliseconds();
+    for (int i = 0; i < numVertices; i += 2) {
+        graph.removeVertex(i);
+    }
+    double end_time = getMilliseconds();
+    cout << "1. removeVertex con " << numVertices / 2 << " vértices: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getVertexCount() == numVertices / 2);
+    // Sobreviven las aristas entre vértices impares: saltos pares (2 y 4) desde un impar
+    assert(graph.getEdgeCount() == 2 * (numVertices / 2));
+    assert(!graph.containsEdge(1, 2));
+    assert(graph.containsEdge(1, 3));
+    assert(graph.containsEdge(3, 1));
+
+    // 2. Lazos y copias conservan las mitades gemelas
+    graph.addEdge(1, 1, 5.0);
+    assert(graph.getEdgeCount() == 2 * (numVertices / 2) + 1);
+    NonDirectedGraph<int> copia(graph);
+    assert(copia.getEdgeCount() == graph.getEdgeCount());
+    copia.removeVertex(1);
+    assert(!copia.containsEdge(3, 1));
+    assert(copia.getEdgeCount() == graph.getEdgeCount() - 5); // cuatro vecinos impares y el lazo
+    assert(graph.containsEdge(3, 1));
+    copia.removeEdge(3, 5);
+    assert(!copia.containsEdge(5, 3));
+    assert(graph.containsEdge(5, 3));
+    cout << "2. lazos y grafos copiados: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba de removeVertex O(grado) ---" << std::endl;
+}
+
+// Prueba de estrés de DirectedGraph: misma carga que la prueba de NonDirectedGraph,
+// verificando la dirección de las aristas, los grados de entrada y la copia.
+void pruebaEstresDirigido() {
+    std::cout << "--- Prueba de Estrés de DirectedGraph con Muchos Nodos ---" << std::endl;
+
+    DirectedGraph<int> graph;
+    int numVertices = 10000;
+    int numAristas = 50000;
+
+    // 1. addVertex
+    double start_time = getMilliseconds();
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addVertex(i);
+        assert(graph.containsVertex(i));
+    }
+    double end_time = getMilliseconds();
+    cout << "1. addVertex con " << numVertices << " vértices: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getVertexCount() == numVertices);
+
+    // 2. addEdge: la arista inversa no debe existir
+    start_time = getMilliseconds();
+    for (int i = 0; i < numAristas; ++i) {
+        int source = i % numVertices;
+        int dest = (i + i / numVertices + 1) % numVertices;
+        double weight = (i % 100) / 10.0;
+        graph.addEdge(source, dest, weight);
+        assert(graph.containsEdge(source, dest));
+        assert(!graph.containsEdge(dest, source));
+        assert(abs(graph.edgeWeight(source, dest) - weight) < 0.0001);
+    }
+    end_time = getMilliseconds();
+    cout << "2. addEdge con " << numAristas << " aristas: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getEdgeCount() == numAristas);
+    assert(graph.inDegree(7) == 5);
+    assert(graph.outDegree(7) == 5);
+    assert(graph.getPredecessors(7).size() == 5);
+
+    // 3. Copia: conserva aristas y grados sin compartir nodos
+    start_time = getMilliseconds();
+    DirectedGraph<int> copia(graph);
+    end_time = getMilliseconds();
+    cout << "3. constructor de copia: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(copia.getEdgeCount() == numAristas);
+    assert(copia.containsEdge(7, 8));
+    assert(!copia.containsEdge(8, 7));
+    assert(copia.inDegree(7) == 5);
+
+    // 4. removeEdge
+    start_time = getMilliseconds();
+    for (int i = 0; i < numAristas / 2; ++i) {
+        int source = i % numVertices;
+        int dest = (i + i / numVertices + 1) % numVertices;
+        graph.removeEdge(source, dest);
+        assert(!graph.containsEdge(source, dest));
+    }
+    end_time = getMilliseconds();
+    cout << "4. removeEdge con " << numAristas / 2 << " aristas: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getEdgeCount() == numAristas - (numAristas / 2));
+
+    // 5. removeVertex: solo recorre las listas de salida y entrada del vértice
+    start_time = getMilliseconds();
+    int restantes = graph.getEdgeCount();
+    for (int i = 0; i < numVertices / 2; ++i) {
+        restantes -= graph.inDegree(i) + graph.outDegree(i);
+        if (graph.containsEdge(i, i)) restantes++;
+        graph.removeVertex(i);
+        assert(!graph.containsVertex(i));
+    }
+    end_time = getMilliseconds();
+    cout << "5. removeVertex con " << numVertices / 2 << " vértices: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getVertexCount() == numVertices - (numVertices / 2));
+    assert(graph.getEdgeCount() == restantes);
+    assert(graph.inDegree(numVertices / 2) == 0 || graph.getPredecessors(numVertices / 2)[0] >= numVertices / 2);
+
+    // 6. clear
+    graph.clear();
+    assert(graph.isEmpty());
+    assert(graph.getEdgeCount() == 0);
+    assert(copia.getEdgeCount() == numAristas);
+    cout << "6. clear: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba de Estrés de DirectedGraph ---" << std::endl;
+}
+
+// Prueba de carga masiva: addVertices/addEdges frente a llamadas sucesivas a addEdge,
+// con aristas repetidas (en ambos sentidos) dentro del lote.
+void pruebaCargaMasiva() {
+    std::cout << "--- Prueba de Carga Masiva (addVertices / addEdges) ---" << std::endl;
+
+    int numVertices = 200000;
+    int numAristas = 2000000;
+    std::vector<int> vertices;
+    for (int i = 0; i < numVertices; ++i) {
+        vertices.push_back(i);
+    }
+    std::vector<NonDirectedGraph<int>::Edge> lote;
+    for (int i = 0; i < numAristas; ++i) {
+        int source = i % numVertices;
+        int dest = (i + (i / numVertices) % 5 + 1) % numVertices; // a partir de la sexta vuelta se repiten aristas
+        if (i % 2 == 0) {
+            lote.push_back(NonDirectedGraph<int>::Edge(source, dest, 1.0));
+        } else {
+            lote.push_back(NonDirectedGraph<int>::Edge(dest, source, 1.0));
+        }
+    }
+
+    // 1. Carga arista por arista
+    NonDirectedGraph<int> uno;
+    double start_time = getMilliseconds();
+    for (int i = 0; i < numVertices; ++i) {
+        uno.addVertex(vertices[i]);
+    }
+    for (int i = 0; i < numAristas; ++i) {
+        uno.addEdge(lote[i].source, lote[i].destination, lote[i].weight);
+    }
+    double end_time = getMilliseconds();
+    cout << "1. addVertex + addEdge con " << numAristas << " aristas: Tiempo: " << end_time - start_time << " ms" << endl;
+
+    // 2. Carga en bloque
+    NonDirectedGraph<int> bloque;
+    start_time = getMilliseconds();
+    bloque.addVertices(vertices.begin(), vertices.end());
+    int agregadas = bloque.addEdges(lote);
+    end_time = getMilliseconds();
+    double elapsed = end_time - start_time;
+    cout << "2. addVertices + addEdges con " << numAristas << " aristas: OK. Tiempo: " << elapsed << " ms";
+    if (elapsed > 0) {
+        cout << " (" << static_cast<long>(numAristas / (elapsed / 1000.0)) << " aristas/s)";
+    }
+    cout << endl;
+    assert(bloque.getVertexCount() == numVertices);
+    assert(agregadas == uno.getEdgeCount());
+    assert(bloque.getEdgeCount() == 5 * numVertices);
+    assert(bloque.containsEdge(10, 15) && bloque.containsEdge(15, 10));
+
+    // 3. Un segundo lote solo agrega lo que falta
+    std::vector<NonDirectedGraph<int>::Edge> extra;
+    extra.push_back(NonDirectedGraph<int>::Edge(0, 1, 3.0)); // ya existe
+    extra.push_back(NonDirectedGraph<int>::Edge(0, 100, 3.0));
+    extra.push_back(NonDirectedGraph<int>::Edge(100, 0, 4.0)); // repetida en el lote
+    extra.push_back(NonDirectedGraph<int>::Edge(0, -5, 3.0)); // extremo inexistente
+    assert(bloque.addEdges(extra) == 1);
+    assert(abs(bloque.edgeWeight(100, 0) - 3.0) < 0.0001);
+    assert(abs(bloque.edgeWeight(0, 1) - 1.0) < 0.0001);
+    // un vértice de grado alto consulta su índice hash en lugar de marcar sus vecinos; el lote chico no se ordena por conteo
+    NonDirectedGraph<int> estrella;
+    for (int i = 0; i < 200000; ++i) estrella.addVertex(i);
+    for (int i = 1; i <= 100; ++i) estrella.addEdge(0, i);
+    std::vector<NonDirectedGraph<int>::Edge> haciaCentro;
+    haciaCentro.push_back(NonDirectedGraph<int>::Edge(50, 0, 2.0)); // ya existe
+    haciaCentro.push_back(NonDirectedGraph<int>::Edge(0, 150000, 2.0));
+    haciaCentro.push_back(NonDirectedGraph<int>::Edge(150000, 0, 5.0)); // repetida en el lote
+    haciaCentro.push_back(NonDirectedGraph<int>::Edge(7, 8, 2.0));
+    assert(estrella.addEdges(haciaCentro) == 2 && estrella.getEdgeCount() == 102);
+    assert(abs(estrella.edgeWeight(0, 150000) - 2.0) < 0.0001 && abs(estrella.edgeWeight(0, 50) - 1.0) < 0.0001);
+    cout << "3. lote con aristas existentes, repetidas e inválidas: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba de Carga Masiva ---" << std::endl;
+}
+
+// Prueba de copia lineal: el constructor de copia y copy() conservan los índices internos,
+// el orden de las listas y las mitades gemelas, en tiempo O(V + E).
+void pruebaCopiaLineal() {
+    std::cout << "--- Prueba de Copia Lineal de Grafos ---" << std::endl;
+
+    NonDirectedGraph<int> graph;
+    int numVertices = 200000;
+    int numAristas = 1000000;
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addVertex(i);
+    }
+    for (int i = 0; i < numAristas; ++i) {
+        graph.addEdge(i % numVertices, (i + i / numVertices + 1) % numVertices, (i % 100) / 10.0);
+    }
+    graph.removeVertex(5); // deja un índice libre en la tabla
+
+    // 1. Constructor de copia
+    double start_time = getMilliseconds();
+    NonDirectedGraph<int> copia(graph);
+    double end_time = getMilliseconds();
+    cout << "1. constructor de copia con " << numAristas << " aristas: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(copia.getVertexCount() == graph.getVertexCount());
+    assert(copia.getEdgeCount() == graph.getEdgeCount());
+    assert(copia.getIndexByData(numVertices - 1) == graph.getIndexByData(numVertices - 1));
+
+    // 2. La instantánea de la copia coincide entrada por entrada con la del original
+    const CsrView& original = graph.freeze();
+    const CsrView& copiada = copia.freeze();
+    assert(original.getEntryCount() == copiada.getEntryCount());
+    for (int e = 0; e < original.getEntryCount(); ++e) {
+        assert(original.target(e) == copiada.target(e));
+        assert(original.weight(e) == copiada.weight(e));
+    }
+    cout << "2. adyacencia e índices idénticos: OK" << endl;
+
+    // 3. copy() sobre un grafo existente y eliminación posterior con gemelas
+    NonDirectedGraph<int> destino;
+    destino.addVertex(-1);
+    start_time = getMilliseconds();
+    destino.copy(graph);
+    end_time = getMilliseconds();
+    cout << "3. copy(): OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(!destino.containsVertex(-1));
+    assert(destino.getEdgeCount() == graph.getEdgeCount());
+    destino.removeVertex(10);
+    assert(!destino.containsEdge(11, 10));
+    assert(graph.containsEdge(11, 10));
+
+    // 4. si las aristas no se pueden copiar (aquí, un grafo de otro tipo) la copia queda vacía y sin aristas contadas
+    DirectedGraph<int> dirigido;
+    dirigido.addVertex(1);
+    dirigido.addVertex(2);
+    dirigido.addEdge(1, 2);
+    assert(!destino.copy(dirigido));
+    assert(destino.getVertexCount() == 0 && destino.getEdgeCount() == 0);
+    cout << "4. copia fallida: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba de Copia Lineal ---" << std::endl;
+}
+
+// Prueba de la tabla de índices: un vértice cuyo dato es T() (el 0) sigue siendo válido,
+// los índices liberados se reutilizan y compactIndices renumera de forma densa.
+void pruebaTablaIndices() {
+    std::cout << "--- Prueba de la Tabla de Índices con Reciclaje ---" << std::endl;
+
+    NonDirectedGraph<int> graph;
+    int numVertices = 100000;
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addVertex(i);
+    }
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addEdge(i, (i + 1) % numVertices, 2.0);
+    }
+
+    // 1. El vértice 0 (igual a int()) se reconoce por índice
+    assert(graph.containsVertexByIndex(graph.getIndexByData(0)));
+    assert(graph.containsEdgeByIndex(graph.getIndexByData(0), graph.getIndexByData(1)));
+    assert(abs(graph.edgeWeightByIndex(graph.getIndexByData(1), graph.getIndexByData(0)) - 2.0) < 0.0001);
+    cout << "1. vértice con dato por defecto: OK" << endl;
+
+    // 2. Ciclos de eliminación e inserción no hacen crecer la tabla
+    double start_time = getMilliseconds();
+    for (int ronda = 0; ronda < 10; ++ronda) {
+        for (int i = 0; i < numVertices; i += 2) {
+            graph.removeVertex(i);
+        }
+        for (int i = 0; i < numVertices; i += 2) {
+            graph.addVertex(i);
+        }
+    }
+    double end_time = getMilliseconds();
+    cout << "2. 10 rondas de " << numVertices / 2 << " eliminaciones e inserciones: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getIndexCapacity() == numVertices);
+    assert(graph.getFreeIndexCount() == 0);
+    assert(graph.getVertexCount() == numVertices);
+    assert(graph.getDataByIndex(graph.getIndexByData(42)) == 42);
+
+    // 3. Las consultas por índice van directo a la casilla
+    for (int i = 1; i < numVertices - 2; i += 2) {
+        graph.addEdge(i, i + 2, 1.0);
+    }
+    start_time = getMilliseconds();
+    for (int i = 1; i < numVertices - 2; i += 2) {
+        assert(graph.containsEdgeByIndex(graph.getIndexByData(i), graph.getIndexByData(i + 2)));
+        assert(!graph.containsEdgeByIndex(graph.getIndexByData(i), graph.getIndexByData(i + 1)));
+    }
+    end_time = getMilliseconds();
+    cout << "3. containsEdgeByIndex: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+
+    // 4. compactIndices renumera densamente tras eliminar vértices
+    for (int i = 0; i < numVertices; i += 4) {
+        graph.removeVertex(i);
+    }
+    assert(graph.getFreeIndexCount() == numVertices / 4);
+    int indiceAntes = graph.getIndexByData(7);
+    std::vector<int> traduccion = graph.compactIndices();
+    assert(graph.getIndexCapacity() == graph.getVertexCount());
+    assert(graph.getFreeIndexCount() == 0);
+    assert(traduccion[indiceAntes] == graph.getIndexByData(7));
+    for (int i = 0; i < graph.getIndexCapacity(); ++i) {
+        assert(graph.containsVertexByIndex(i));
+        assert(graph.getIndexByData(graph.getDataByIndex(i)) == i);
+    }
+    assert(graph.containsEdgeByIndex(graph.getIndexByData(1), graph.getIndexByData(3)));
+    assert(graph.freeze().getVertexSlots() == graph.getVertexCount());
+    cout << "4. compactIndices: OK" << endl;
+
+    // 5. datos reales: 0.0 y -0.0 son iguales, así que deben resolver al mismo índice
+    NonDirectedGraph<double> reales;
+    reales.addVertex(0.0);
+    reales.addVertex(2.5);
+    reales.addVertex(-0.0);
+    assert(reales.getVertexCount() == 2 && reales.containsVertex(-0.0));
+    assert(reales.getIndexByData(-0.0) == reales.getIndexByData(0.0));
+    reales.addEdge(-0.0, 2.5, 1.0);
+    assert(reales.containsEdge(0.0, 2.5));
+    cout << "5. claves reales con cero negativo: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba de la Tabla de Índices ---" << std::endl;
+}
+
+// Prueba de adyacencia híbrida sobre un grafo con distribución de grados de ley de potencias
+// (enlace preferencial): los vértices concentradores consultan sus aristas con un índice hash.
+void pruebaAdyacenciaHibrida() {
+    std::cout << "--- Prueba de Adyacencia Híbrida en Grafos de Ley de Potencias ---" << std::endl;
+
+    NonDirectedGraph<int> graph;
+    int numVertices = 200000;
+    int aristasPorVertice = 5;
+    unsigned long semilla = 12345;
+    std::vector<int> extremos; // cada vértice aparece tantas veces como su grado
+
+    double start_time = getMilliseconds();
+    for (int i = 0; i <= aristasPorVertice; ++i) {
+        graph.addVertex(i);
+    }
+    for (int i = 0; i <= aristasPorVertice; ++i) {
+        for (int j = i + 1; j <= aristasPorVertice; ++j) {
+            graph.addEdge(i, j, 1.0);
+            extremos.push_back(i);
+            extremos.push_back(j);
+        }
+    }
+    for (int v = aristasPorVertice + 1; v < numVertices; ++v) {
+        graph.addVertex(v);
+        for (int k = 0; k < aristasPorVertice; ++k) {
+            int destino = extremos[siguienteAleatorio(semilla) % extremos.size()];
+            if (!graph.containsEdge(v, destino)) {
+                graph.addEdge(v, destino, 1.0);
+                extremos.push_back(v);
+                extremos.push_back(destino);
+            }
+        }
+    }
+    double end_time = getMilliseconds();
+    int concentrador = 0;
+    for (int i = 0; i <= aristasPorVertice; ++i) {
+        if (graph.getDegree(i) > graph.getDegree(concentrador)) concentrador = i;
+    }
+    cout << "1. enlace preferencial con " << numVertices << " vértices y " << graph.getEdgeCount()
+         << " aristas: Tiempo: " << end_time - start_time << " ms (grado máximo: " << graph.getDegree(concentrador) << ")" << endl;
+
+    // 2. Consultas sobre el concentrador: O(1) esperado sin importar su grado
+    int consultas = 1000000;
+    int encontradas = 0;
+    start_time = getMilliseconds();
+    for (int q = 0; q < consultas; ++q) {
+        int destino = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        if (graph.containsEdge(concentrador, destino)) encontradas++;
+    }
+    end_time = getMilliseconds();
+    cout << "2. " << consultas << " containsEdge sobre el concentrador: Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(encontradas > 0);
+
+    // 3. Las mismas consultas sobre vértices de grado bajo (lista corta)
+    start_time = getMilliseconds();
+    for (int q = 0; q < consultas; ++q) {
+        int origen = numVertices - 1 - static_cast<int>(siguienteAleatorio(semilla) % 1000);
+        int destino = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        graph.containsEdge(origen, destino);
+    }
+    end_time = getMilliseconds();
+    cout << "3. " << consultas << " containsEdge sobre vértices de grado bajo: Tiempo: " << end_time - start_time << " ms" << endl;
+
+    // 4. Eliminar aristas del concentrador mantiene el índice coherente
+    int grado = graph.getDegree(concentrador);
+    int eliminadas = 0;
+    for (int v = numVertices - 1; v > aristasPorVertice && eliminadas < grado / 2; --v) {
+        if (graph.containsEdge(concentrador, v)) {
+            graph.removeEdge(v, concentrador);
+            assert(!graph.containsEdge(concentrador, v));
+            eliminadas++;
+        }
+    }
+    assert(graph.getDegree(concentrador) == grado - eliminadas);
+    graph.addEdge(concentrador, concentrador, 1.0);
+    graph.removeEdge(concentrador, concentrador);
+    assert(!graph.containsEdge(concentrador, concentrador));
+    cout << "4. eliminación de " << eliminadas << " aristas del concentrador: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba de Adyacencia Híbrida ---" << std::endl;
+}
+
+// Prueba del recorrido en anchura con optimización de dirección sobre grafos aleatorios de tamaño creciente
+void pruebaBfsDireccional() {
+    std::cout << "--- Prueba de BFS con Optimización de Dirección ---" << std::endl;
+
+    // 1. Casos pequeños: componente aislada, origen inexistente y padres coherentes
+    NonDirectedGraph<int> chico;
+    for (int i = 0; i < 6; ++i) chico.addVertex(i * 10);
+    chico.addEdge(0, 10, 1.0);
+    chico.addEdge(10, 20, 1.0);
+    chico.addEdge(0, 30, 1.0);
+    chico.addEdge(40, 50, 1.0);
+    BfsResult r = breadthFirstSearch(chico, 0);
+    assert(r.reached == 4 && r.levels == 2);
+    assert(r.distance[chico.getIndexByData(20)] == 2);
+    assert(r.parent[chico.getIndexByData(20)] == chico.getIndexByData(10));
+    assert(r.distance[chico.getIndexByData(50)] == -1);
+    assert(breadthFirstSearch(chico, 99).reached == 0);
+    cout << "1. componentes y origen inexistente: OK" << endl;
+
+    // 2. Escalado con el tamaño: descendente clásico contra optimización de dirección
+    unsigned long semilla = 2024;
+    for (int escala = 15; escala <= 19; escala += 2) {
+        int numVertices = 1 << escala;
+        int numAristas = numVertices * 8; // grado medio 16
+        NonDirectedGraph<int> graph;
+        std::vector<int> vertices;
+        for (int i = 0; i < numVertices; ++i) vertices.push_back(i);
+        std::vector<NonDirectedGraph<int>::Edge> lote;
+        for (int i = 0; i < numAristas; ++i) {
+            int a = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+            int b = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+            lote.push_back(NonDirectedGraph<int>::Edge(a, b, 1.0));
+        }
+        graph.addVertices(vertices.begin(), vertices.end());
+        graph.addEdges(lote);
+        const CsrView& view = graph.freeze();
+
+        double start_time = getMilliseconds();
+        BfsResult clasico = breadthFirstSearch(view, 0, 0);
+        double tiempoClasico = getMilliseconds() - start_time;
+        start_time = getMilliseconds();
+        BfsResult direccional = breadthFirstSearch(view, 0);
+        double tiempoDireccional = getMilliseconds() - start_time;
+
+        cout << "2. 2^" << escala << " vértices, " << graph.getEdgeCount() << " aristas: descendente "
+             << tiempoClasico << " ms, direccional " << tiempoDireccional << " ms ("
+             << direccional.topDownSteps << " niveles descendentes, " << direccional.bottomUpSteps << " ascendentes)";
+        if (tiempoDireccional > 0) {
+            cout << " " << static_cast<long>(view.getEntryCount() / (tiempoDireccional / 1000.0)) << " aristas/s";
+        }
+        cout << endl;
+
+        // las distancias coinciden y cada padre es un vecino del nivel anterior
+        assert(clasico.reached == direccional.reached && clasico.levels == direccional.levels);
+        for (int v = 0; v < view.getVertexSlots(); ++v) {
+            assert(clasico.distance[v] == direccional.distance[v]);
+            int p = direccional.parent[v];
+            if (p >= 0) {
+                assert(direccional.distance[p] == direccional.distance[v] - 1);
+                assert(view.containsEdge(p, v));
+            }
+        }
+    }
+
+    std::cout << "--- Fin de la Prueba de BFS con Optimización de Dirección ---" << std::endl;
+}
+
+// Heurística de A* para una cuadrícula: distancia de Manhattan (los pesos de la cuadrícula son >= 1)
+struct HeuristicaManhattan {
+    const std::vector<int>* fila; // fila de cada índice interno
+    const std::vector<int>* columna; // columna de cada índice interno
+    double operator()(int v, int destino) const {
+        return abs((*fila)[v] - (*fila)[destino]) + abs((*columna)[v] - (*columna)[destino]);
+    }
+};
+
+// Prueba de caminos mínimos: Dijkstra con montículo indexado, Dijkstra bidireccional y A*
+void pruebaCaminosMinimos() {
+    std::cout << "--- Prueba de Caminos Mínimos (Dijkstra, Bidireccional y A*) ---" << std::endl;
+
+    // 1. Grafo dirigido pequeño con caminos alternativos
+    DirectedGraph<int> dirigido;
+    for (int i = 1; i <= 6; ++i) dirigido.addVertex(i);
+    dirigido.addEdge(1, 2, 7.0);
+    dirigido.addEdge(1, 3, 9.0);
+    dirigido.addEdge(1, 6, 14.0);
+    dirigido.addEdge(2, 3, 10.0);
+    dirigido.addEdge(2, 4, 15.0);
+    dirigido.addEdge(3, 4, 11.0);
+    dirigido.addEdge(3, 6, 2.0);
+    dirigido.addEdge(6, 5, 9.0);
+    dirigido.addEdge(4, 5, 6.0);
+    ShortestPathResult desdeUno = dijkstra(dirigido, 1);
+    assert(abs(desdeUno.distance[dirigido.getIndexByData(5)] - 20.0) < 0.0001);
+    assert(desdeUno.predecessor[dirigido.getIndexByData(6)] == dirigido.getIndexByData(3));
+    ShortestPathResult desdeCinco = dijkstra(dirigido, 5);
+    assert(desdeCinco.distance[dirigido.getIndexByData(1)] == -1.0); // sin aristas salientes desde 5
+
+    const CsrView& vista = dirigido.freeze();
+    CsrView inversa;
+    vista.transposeInto(inversa);
+    ShortestPathQuery consultaDirigida(vista, inversa);
+    int uno = dirigido.getIndexByData(1);
+    int cinco = dirigido.getIndexByData(5);
+    assert(abs(consultaDirigida.bidirectional(uno, cinco) - 20.0) < 0.0001);
+    std::vector<int> camino;
+    assert(consultaDirigida.getPath(camino) && camino.size() == 4);
+    assert(dirigido.getDataByIndex(camino[1]) == 3 && dirigido.getDataByIndex(camino[2]) == 6);
+    assert(consultaDirigida.bidirectional(cinco, uno) == -1.0);
+    assert(!consultaDirigida.getPath(camino));
+    cout << "1. grafo dirigido pequeño (distancias, caminos y destinos inalcanzables): OK" << endl;
+
+    // 2. Cuadrícula con pesos aleatorios en [1, 2): muchas consultas de punto a punto
+    int lado = 300;
+    NonDirectedGraph<int> cuadricula;
+    std::vector<int> vertices;
+    for (int i = 0; i < lado * lado; ++i) vertices.push_back(i);
+    cuadricula.addVertices(vertices.begin(), vertices.end());
+    unsigned long semilla = 77;
+    std::vector<NonDirectedGraph<int>::Edge> lote;
+    for (int f = 0; f < lado; ++f) {
+        for (int c = 0; c < lado; ++c) {
+            int v = f * lado + c;
+            if (c + 1 < lado) lote.push_back(NonDirectedGraph<int>::Edge(v, v + 1, 1.0 + (siguienteAleatorio(semilla) % 100) / 100.0));
+            if (f + 1 < lado) lote.push_back(NonDirectedGraph<int>::Edge(v, v + lado, 1.0 + (siguienteAleatorio(semilla) % 100) / 100.0));
+        }
+    }
+    cuadricula.addEdges(lote);
+    const CsrView& malla = cuadricula.freeze();
+    std::vector<int> fila(malla.getVertexSlots());
+    std::vector<int> columna(malla.getVertexSlots());
+    for (int i = 0; i < malla.getVertexSlots(); ++i) {
+        fila[i] = cuadricula.getDataByIndex(i) / lado;
+        columna[i] = cuadricula.getDataByIndex(i) % lado;
+    }
+    HeuristicaManhattan manhattan;
+    manhattan.fila = &fila;
+    manhattan.columna = &columna;
+
+    int numConsultas = 100;
+    std::vector<std::pair<int, int> > consultas;
+    for (int q = 0; q < numConsultas; ++q) {
+        int a = static_cast<int>(siguienteAleatorio(semilla) % (lado * lado));
+        int b = static_cast<int>(siguienteAleatorio(semilla) % (lado * lado));
+        consultas.push_back(std::make_pair(cuadricula.getIndexByData(a), cuadricula.getIndexByData(b)));
+    }
+    std::vector<double> esperadas(numConsultas);
+    ShortestPathQuery consulta(malla);
+
+    const char* nombres[3] = {"Dijkstra", "bidireccional", "A*"};
+    for (int metodo = 0; metodo < 3; ++metodo) {
+        long extraidos = 0;
+        double start_time = getMilliseconds();
+        for (int q = 0; q < numConsultas; ++q) {
+            double d;
+            if (metodo == 0) {
+                d = consulta.dijkstra(consultas[q].first, consultas[q].second);
+                esperadas[q] = d;
+            } else if (metodo == 1) {
+                d = consulta.bidirectional(consultas[q].first, consultas[q].second);
+            } else {
+                d = consulta.aStar(consultas[q].first, consultas[q].second, manhattan);
+            }
+            assert(abs(d - esperadas[q]) < 0.0001);
+            // el camino reconstruido suma exactamente la distancia
+            assert(consulta.getPath(camino));
+            double suma = 0.0;
+            for (std::size_t k = 1; k < camino.size(); ++k) suma += malla.edgeWeight(camino[k - 1], camino[k]);
+            assert(abs(suma - d) < 0.0001);
+            extraidos += consulta.getSettledCount();
+        }
+        double elapsed = getMilliseconds() - start_time;
+        cout << "2. " << numConsultas << " consultas " << nombres[metodo] << " en cuadrícula " << lado << "x" << lado
+             << ": Tiempo: " << elapsed << " ms, " << extraidos / numConsultas << " vértices extraídos por consulta";
+        if (elapsed > 0) cout << " (" << static_cast<long>(numConsultas / (elapsed / 1000.0)) << " consultas/s)";
+        cout << endl;
+    }
+
+    // 3. Dijkstra desde un origen coincide con las consultas de punto a punto
+    double start_time = getMilliseconds();
+    ShortestPathResult completo = dijkstra(malla, consultas[0].first);
+    double end_time = getMilliseconds();
+    assert(completo.settled == lado * lado);
+    for (int q = 0; q < numConsultas; ++q) {
+        if (consultas[q].first != consultas[0].first) continue;
+        assert(abs(completo.distance[consultas[q].second] - esperadas[q]) < 0.0001);
+    }
+    assert(abs(consulta.dijkstra(consultas[0].first, consultas[1].second) - completo.distance[consultas[1].second]) < 0.0001);
+    cout << "3. Dijkstra desde un origen sobre " << lado * lado << " vértices: Tiempo: " << end_time - start_time << " ms" << endl;
+
+    std::cout << "--- Fin de la Prueba de Caminos Mínimos ---" << std::endl;
+}
+
+// Prueba de componentes conexas con conjuntos disjuntos sobre un grafo con componentes conocidas
+void pruebaComponentesConexas() {
+    std::cout << "--- Prueba de Componentes Conexas (Union-Find) ---" << std::endl;
+
+    int numVertices = 1000000;
+    int tamBloque = 1000; // cada bloque de índices consecutivos forma una componente
+    NonDirectedGraph<int> graph;
+    std::vector<int> vertices;
+    for (int i = 0; i < numVertices; ++i) vertices.push_back(i);
+    graph.addVertices(vertices.begin(), vertices.end());
+    unsigned long semilla = 31;
+    std::vector<NonDirectedGraph<int>::Edge> lote;
+    for (int v = 0; v < numVertices; ++v) {
+        int base = v - v % tamBloque;
+        // un camino une el bloque y las aristas aleatorias quedan dentro del mismo bloque
+        if (v + 1 < base + tamBloque) lote.push_back(NonDirectedGraph<int>::Edge(v, v + 1, 1.0));
+        lote.push_back(NonDirectedGraph<int>::Edge(v, base + static_cast<int>(siguienteAleatorio(semilla) % tamBloque), 1.0));
+    }
+    graph.addEdges(lote);
+
+    // 1. Etiquetado completo
+    double start_time = getMilliseconds();
+    ComponentResult componentes = connectedComponents(graph);
+    double end_time = getMilliseconds();
+    cout << "1. componentes de " << numVertices << " vértices y " << graph.getEdgeCount() << " aristas: Tiempo: "
+         << end_time - start_time << " ms (incluye freeze)" << endl;
+    assert(componentes.count == numVertices / tamBloque);
+    for (int c = 0; c < componentes.count; ++c) assert(componentes.sizes[c] == tamBloque);
+    assert(componentes.label[graph.getIndexByData(0)] == componentes.label[graph.getIndexByData(tamBloque - 1)]);
+    assert(componentes.label[graph.getIndexByData(0)] != componentes.label[graph.getIndexByData(tamBloque)]);
+
+    // 2. Eliminar el camino de un bloque lo parte; los índices eliminados quedan con etiqueta -1
+    NonDirectedGraph<int> chico;
+    for (int i = 0; i < 10; ++i) chico.addVertex(i);
+    for (int i = 0; i + 1 < 10; ++i) chico.addEdge(i, i + 1, 1.0);
+    int indiceCinco = chico.getIndexByData(5);
+    chico.removeVertex(5);
+    chico.addEdge(9, 9, 1.0);
+    ComponentResult partido = connectedComponents(chico);
+    assert(partido.count == 2 && partido.sizes[0] == 5 && partido.sizes[1] == 4);
+    assert(partido.label[indiceCinco] == -1);
+    assert(partido.label[chico.getIndexByData(4)] != partido.label[chico.getIndexByData(6)]);
+
+    // 3. En un grafo dirigido se obtienen las componentes débilmente conexas
+    DirectedGraph<int> dirigido;
+    for (int i = 0; i < 4; ++i) dirigido.addVertex(i);
+    dirigido.addEdge(0, 1, 1.0);
+    dirigido.addEdge(2, 1, 1.0);
+    assert(connectedComponents(dirigido).count == 2);
+    cout << "2. lápidas, self-loops y grafos dirigidos: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba de Componentes Conexas ---" << std::endl;
+}
+
+// Cuenta los vecinos comunes de dos filas ordenadas de una instantánea CSR (referencia para la matriz de bits)
+int vecinosComunesCsr(const CsrView& view, int a, int b) {
+    int i = view.edgeBegin(a), j = view.edgeBegin(b), comunes = 0;
+    while (i < view.edgeEnd(a) && j < view.edgeEnd(b)) {
+        if (view.target(i) < view.target(j)) {
+            i++;
+        } else if (view.target(i) > view.target(j)) {
+            j++;
+        } else {
+            comunes++;
+            i++;
+            j++;
+        }
+    }
+    return comunes;
+}
+
+// Prueba del grafo denso con matriz de bits frente a las listas de adyacencia
+void pruebaMatrizDensa() {
+    std::cout << "--- Prueba del Grafo Denso con Matriz de Bits ---" << std::endl;
+
+    // 1. Mismo grafo aleatorio con densidad ~20% en ambas representaciones
+    int numVertices = 2000;
+    unsigned long semilla = 99;
+    std::vector<int> vertices;
+    for (int i = 0; i < numVertices; ++i) vertices.push_back(i);
+    std::vector<NonDirectedGraph<int>::Edge> lote;
+    for (int u = 0; u < numVertices; ++u) {
+        for (int v = u + 1; v < numVertices; ++v) {
+            if (siguienteAleatorio(semilla) % 5 == 0) lote.push_back(NonDirectedGraph<int>::Edge(u, v, 1.0));
+        }
+    }
+    NonDirectedGraph<int> listas;
+    listas.addVertices(vertices.begin(), vertices.end());
+    listas.addEdges(lote);
+    DenseNonDirectedGraph<int> densa;
+    double start_time = getMilliseconds();
+    for (int i = 0; i < numVertices; ++i) densa.addVertex(i);
+    for (std::size_t k = 0; k < lote.size(); ++k) densa.addEdge(lote[k].source, lote[k].destination, lote[k].weight);
+    double end_time = getMilliseconds();
+    assert(densa.getEdgeCount() == listas.getEdgeCount());
+    cout << "1. " << densa.getEdgeCount() << " aristas en matriz densa: Tiempo: " << end_time - start_time << " ms, "
+         << densa.getMatrixBytes() / 1024 << " KB de matriz frente a "
+         << 2 * static_cast<long>(listas.getEdgeCount()) * sizeof(AdjacentNode<int>) / 1024 << " KB de nodos adyacentes" << endl;
+
+    // 2. Verificación de aristas: un bit frente a recorrer la lista
+    int consultas = 200000;
+    std::vector<std::pair<int, int> > pares;
+    for (int q = 0; q < consultas; ++q) {
+        pares.push_back(std::make_pair(static_cast<int>(siguienteAleatorio(semilla) % numVertices),
+                                       static_cast<int>(siguienteAleatorio(semilla) % numVertices)));
+    }
+    int enListas = 0, enDensa = 0;
+    start_time = getMilliseconds();
+    for (int q = 0; q < consultas; ++q) if (listas.containsEdge(pares[q].first, pares[q].second)) enListas++;
+    double tiempoListas = getMilliseconds() - start_time;
+    start_time = getMilliseconds();
+    for (int q = 0; q < consultas; ++q) if (densa.containsEdge(pares[q].first, pares[q].second)) enDensa++;
+    double tiempoDensa = getMilliseconds() - start_time;
+    assert(enListas == enDensa);
+    cout << "2. " << consultas << " containsEdge: listas " << tiempoListas << " ms, matriz de bits " << tiempoDensa << " ms" << endl;
+
+    // 3. Vecinos comunes: popcount de la intersección frente a mezclar filas CSR
+    const CsrView& vista = listas.freeze();
+    long sumaCsr = 0, sumaBits = 0;
+    start_time = getMilliseconds();
+    for (int q = 0; q < 20000; ++q) {
+        sumaCsr += vecinosComunesCsr(vista, listas.getIndexByData(pares[q].first), listas.getIndexByData(pares[q].second));
+    }
+    tiempoListas = getMilliseconds() - start_time;
+    start_time = getMilliseconds();
+    for (int q = 0; q < 20000; ++q) sumaBits += densa.commonNeighbors(pares[q].first, pares[q].second);
+    tiempoDensa = getMilliseconds() - start_time;
+    assert(sumaCsr == sumaBits);
+    cout << "3. 20000 conteos de vecinos comunes: mezcla CSR " << tiempoListas << " ms, popcount " << tiempoDensa << " ms" << endl;
+
+    // 4. Triángulos contra un conteo de referencia sobre un grafo más chico
+    DenseNonDirectedGraph<int> chica;
+    NonDirectedGraph<int> chicaListas;
+    for (int i = 0; i < 600; ++i) {
+        chica.addVertex(i);
+        chicaListas.addVertex(i);
+    }
+    for (std::size_t k = 0; k < lote.size(); ++k) {
+        if (lote[k].source < 600 && lote[k].destination < 600) {
+            chica.addEdge(lote[k].source, lote[k].destination, 1.0);
+            chicaListas.addEdge(lote[k].source, lote[k].destination, 1.0);
+        }
+    }
+    chica.addEdge(5, 5, 1.0); // los lazos no forman triángulos
+    const CsrView& chicaVista = chicaListas.freeze();
+    long referencia = 0;
+    for (int u = 0; u < chicaVista.getVertexSlots(); ++u) {
+        for (int e = chicaVista.edgeBegin(u); e < chicaVista.edgeEnd(u); ++e) {
+            if (chicaVista.target(e) > u) referencia += vecinosComunesCsr(chicaVista, u, chicaVista.target(e));
+        }
+    }
+    start_time = getMilliseconds();
+    long triangulos = chica.countTriangles();
+    end_time = getMilliseconds();
+    assert(triangulos == referencia / 3);
+    start_time = getMilliseconds();
+    triangulos = densa.countTriangles();
+    end_time = getMilliseconds();
+    cout << "4. " << triangulos << " triángulos en el grafo de " << numVertices << " vértices: Tiempo: " << end_time - start_time << " ms" << endl;
+
+    // 5. Pesos, eliminación, copia, compactación e instantánea CSR
+    DenseNonDirectedGraph<int> pesada(true);
+    for (int i = 0; i < 100; ++i) pesada.addVertex(i);
+    for (int i = 0; i < 100; ++i) pesada.addEdge(i, (i * 7 + 3) % 100, i + 0.5);
+    assert(abs(pesada.edgeWeight(10, 73) - 10.5) < 0.0001 && abs(pesada.edgeWeight(73, 10) - 10.5) < 0.0001);
+    int aristas = pesada.getEdgeCount();
+    int grado = pesada.getDegree(10);
+    pesada.removeVertex(10);
+    assert(pesada.getEdgeCount() == aristas - grado && !pesada.containsEdge(73, 10));
+    DenseNonDirectedGraph<int> copia(pesada);
+    pesada.compactIndices();
+    assert(pesada.getEdgeCount() == copia.getEdgeCount());
+    const CsrView& vistaCompacta = pesada.freeze();
+    for (int i = 0; i < 100; ++i) {
+        if (i == 10) continue;
+        int j = (i * 7 + 3) % 100;
+        if (j == 10) continue;
+        assert(copia.containsEdge(i, j) && pesada.containsEdge(j, i));
+        assert(abs(vistaCompacta.edgeWeight(pesada.getIndexByData(i), pesada.getIndexByData(j)) - copia.edgeWeight(i, j)) < 0.0001);
+    }
+    pesada.addVertex(500);
+    assert(pesada.getDegree(500) == 0 && pesada.edgeWeight(500, 0) == -1.0);
+    cout << "5. pesos, eliminación, copia, compactación y freeze: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba del Grafo Denso con Matriz de Bits ---" << std::endl;
+}
+
+// Prueba de guardado y carga de grafos en el formato binario de instantáneas
+// Guarda un archivo de grafo no dirigido con filas escritas a mano (vértices 0..n-1) y lo carga en un
+// NonDirectedGraph; devuelve la cantidad de aristas cargadas o -1 si la carga fue rechazada.
+int cargarFilasArtificiales(const char* archivo, int n, const int* grados, const int* vecinos, const double* pesos, int aristas) {
+    std::vector<int> offsets(1, 0);
+    for (int i = 0; i < n; ++i) offsets.push_back(offsets.back() + grados[i]);
+    std::vector<int> destinos(vecinos, vecinos + offsets.back());
+    std::vector<double> conPeso(pesos, pesos + offsets.back());
+    CsrView vista;
+    vista.adopt(offsets, destinos, conPeso, 0);
+    std::vector<int> datos;
+    for (int i = 0; i < n; ++i) datos.push_back(i);
+    std::vector<unsigned char> vivos(n, 1);
+    assert(GraphSnapshot<int>::save(archivo, SNAPSHOT_NON_DIRECTED, SnapshotCodec<double>::tag(), vista, datos, vivos, n, aristas));
+    NonDirectedGraph<int> graph;
+    if (!graph.load(archivo)) return -1;
+    assert(graph.freeze().getNeighbors() == vista.getNeighbors());
+    return graph.getEdgeCount();
+}
+
+void pruebaArchivoBinario() {
+    std::cout << "--- Prueba de Instantáneas Binarias (save / load) ---" << std::endl;
+    const char* archivo = "prueba_instantanea.bin";
+
+    // 1. Grafo grande: reconstruirlo desde cero frente a cargarlo del archivo
+    int numVertices = 500000;
+    int numAristas = 2000000;
+    unsigned long semilla = 4242;
+    std::vector<int> vertices;
+    for (int i = 0; i < numVertices; ++i) vertices.push_back(i * 3);
+    std::vector<NonDirectedGraph<int>::Edge> lote;
+    for (int i = 0; i < numAristas; ++i) {
+        int a = static_cast<int>(siguienteAleatorio(semilla) % numVertices) * 3;
+        int b = static_cast<int>(siguienteAleatorio(semilla) % numVertices) * 3;
+        lote.push_back(NonDirectedGraph<int>::Edge(a, b, (i % 10) + 0.25));
+    }
+    NonDirectedGraph<int> original;
+    double start_time = getMilliseconds();
+    original.addVertices(vertices.begin(), vertices.end());
+    original.addEdges(lote);
+    double end_time = getMilliseconds();
+    original.removeVertex(3); // deja una lápida en la tabla de índices
+    cout << "1. construcción con addEdges: Tiempo: " << end_time - start_time << " ms" << endl;
+
+    start_time = getMilliseconds();
+    assert(original.save(archivo));
+    end_time = getMilliseconds();
+    cout << "2. save: Tiempo: " << end_time - start_time << " ms (incluye freeze)" << endl;
+
+    GraphSnapshot<int> soloLectura;
+    start_time = getMilliseconds();
+    assert(soloLectura.load(archivo));
+    end_time = getMilliseconds();
+    cout << "3. apertura de solo lectura (CsrView): Tiempo: " << end_time - start_time << " ms" << endl;
+
+    NonDirectedGraph<int> cargado;
+    start_time = getMilliseconds();
+    assert(cargado.load(archivo));
+    end_time = getMilliseconds();
+    cout << "4. load en NonDirectedGraph: Tiempo: " << end_time - start_time << " ms" << endl;
+
+    // el contenido coincide: mismos índices, mismas filas y mismos pesos
+    const CsrView& vistaOriginal = original.freeze();
+    assert(cargado.isFrozen());
+    assert(cargado.getVertexCount() == original.getVertexCount() && cargado.getEdgeCount() == original.getEdgeCount());
+    assert(soloLectura.getView().getNeighbors() == vistaOriginal.getNeighbors());
+    assert(soloLectura.getView().getWeights() == vistaOriginal.getWeights());
+    assert(soloLectura.getIndexByData(6) == original.getIndexByData(6) && soloLectura.getIndexByData(3) == -1);
+    assert(!cargado.containsVertex(3) && cargado.getFreeIndexCount() == 1);
+    for (int i = 0; i < 1000; ++i) {
+        assert(cargado.getIndexByData(lote[i].source) == original.getIndexByData(lote[i].source));
+        assert(cargado.edgeWeight(lote[i].source, lote[i].destination) == original.edgeWeight(lote[i].source, lote[i].destination));
+    }
+    cargado.thaw();
+    assert(cargado.freeze().getNeighbors() == vistaOriginal.getNeighbors()); // las listas reconstruidas dan la misma instantánea
+    cargado.removeVertex(6);
+    cargado.addVertex(3);
+    assert(cargado.getIndexByData(3) == original.getIndexByData(6)); // reutiliza el último índice liberado
+
+    // 5. Otros tipos de grafo y de dato, y archivos inválidos
+    DirectedGraph<std::string> dirigido;
+    dirigido.addVertex("a");
+    dirigido.addVertex("bb");
+    dirigido.addVertex("ccc");
+    dirigido.addEdge("a", "bb", 2.0);
+    dirigido.addEdge("bb", "a", 3.0);
+    dirigido.addEdge("ccc", "ccc", 4.0);
+    assert(dirigido.save(archivo));
+    DirectedGraph<std::string> dirigidoCargado;
+    assert(dirigidoCargado.load(archivo));
+    assert(dirigidoCargado.edgeWeight("bb", "a") == 3.0 && dirigidoCargado.inDegree("a") == 1 && dirigidoCargado.containsEdge("ccc", "ccc"));
+    assert(!cargado.load(archivo)); // tipo de dato distinto
+    NonDirectedGraph<std::string> otroTipo;
+    assert(!otroTipo.load(archivo)); // tipo de grafo distinto
+    NonDirectedGraph<int> enteros;
+    enteros.addVertex(1);
+    enteros.addVertex(2);
+    enteros.addEdge(1, 2, 0.5);
+    assert(enteros.save(archivo));
+    NonDirectedGraph<unsigned int> sinSigno;
+    NonDirectedGraph<float> flotantes;
+    NonDirectedGraph<int, float> pesosFloat;
+    assert(!sinSigno.load(archivo) && !flotantes.load(archivo) && !pesosFloat.load(archivo)); // mismo tamaño, otro tipo
+    NonDirectedGraph<int> enterosCargado;
+    assert(enterosCargado.load(archivo) && enterosCargado.edgeWeight(1, 2) == 0.5);
+    enterosCargado.addVertex(3);
+    enterosCargado.addEdge(2, 3, 1.5);
+    int repetido = 1; // el último dato de la tabla pasa a repetir el primero
+    std::FILE* conRepetidos = std::fopen(archivo, "r+b");
+    std::fseek(conRepetidos, -static_cast<long>(sizeof(int)), SEEK_END);
+    std::fwrite(&repetido, sizeof(repetido), 1, conRepetidos);
+    std::fclose(conRepetidos);
+    assert(!enterosCargado.load(archivo)); // la carga fallida conserva el contenido anterior
+    assert(enterosCargado.getVertexCount() == 3 && enterosCargado.getEdgeCount() == 2);
+    assert(enterosCargado.edgeWeight(1, 2) == 0.5 && enterosCargado.edgeWeight(2, 3) == 1.5);
+
+    DenseNonDirectedGraph<int> densa(true);
+    for (int i = 0; i < 50; ++i) densa.addVertex(i);
+    for (int i = 0; i < 50; ++i) densa.addEdge(i, (i * i) % 50, i + 1.0);
+    assert(densa.save(archivo));
+    DenseNonDirectedGraph<int> densaCargada(true);
+    assert(densaCargada.load(archivo));
+    assert(densaCargada.getEdgeCount() == densa.getEdgeCount() && densaCargada.countTriangles() == densa.countTriangles());
+    assert(densaCargada.edgeWeight(7, 49) == densa.edgeWeight(7, 49) && densaCargada.getDegree(0) == densa.getDegree(0));
+
+    // conteos de la cabecera que no caben en el archivo o no coinciden con las secciones: se rechazan sin reservar
+    int conteoFalso = 0x7ffffff0;
+    std::FILE* alterado = std::fopen(archivo, "r+b");
+    std::fseek(alterado, offsetof(SnapshotHeader, slots), SEEK_SET);
+    std::fwrite(&conteoFalso, sizeof(conteoFalso), 1, alterado);
+    std::fclose(alterado);
+    assert(!densaCargada.load(archivo) && !soloLectura.load(archivo));
+    assert(densa.save(archivo));
+    conteoFalso = densa.getEdgeCount() + 1;
+    alterado = std::fopen(archivo, "r+b");
+    std::fseek(alterado, offsetof(SnapshotHeader, edgeCount), SEEK_SET);
+    std::fwrite(&conteoFalso, sizeof(conteoFalso), 1, alterado);
+    std::fclose(alterado);
+    assert(!densaCargada.load(archivo));
+    assert(densa.save(archivo));
+
+    // filas no dirigidas escritas a mano: deben ser simétricas, con el mismo peso en ambas mitades y un lazo en dos entradas
+    const int gradosValidos[] = {1, 1, 2, 0};
+    const int vecinosValidos[] = {1, 0, 2, 2};
+    const double pesosValidos[] = {1.5, 1.5, 3.0, 3.0};
+    assert(cargarFilasArtificiales(archivo, 4, gradosValidos, vecinosValidos, pesosValidos, 2) == 2);
+    const int gradosAsimetricos[] = {2, 2, 0, 0};
+    const int vecinosAsimetricos[] = {1, 2, 2, 3}; // la fila 0 nombra a 1 y 2, pero ninguna de ellas nombra a 0
+    const double pesosUno[] = {1.0, 1.0, 1.0, 1.0};
+    assert(cargarFilasArtificiales(archivo, 4, gradosAsimetricos, vecinosAsimetricos, pesosUno, 2) == -1);
+    const int gradosPar[] = {1, 1, 0, 0};
+    const double pesosDistintos[] = {1.0, 2.0};
+    assert(cargarFilasArtificiales(archivo, 4, gradosPar, vecinosValidos, pesosDistintos, 1) == -1);
+    const int gradosTresLazos[] = {3, 0, 0, 0};
+    const int tresLazos[] = {0, 0, 0};
+    assert(cargarFilasArtificiales(archivo, 4, gradosTresLazos, tresLazos, pesosUno, 1) == -1);
+    assert(cargarFilasArtificiales(archivo, 4, gradosTresLazos, tresLazos, pesosUno, 2) == -1);
+    assert(densa.save(archivo));
+
+    std::FILE* truncado = std::fopen(archivo, "r+b");
+    std::fseek(truncado, 0, SEEK_SET);
+    std::fputc('X', truncado);
+    std::fclose(truncado);
+    assert(!densaCargada.load(archivo) && densaCargada.getEdgeCount() == densa.getEdgeCount()); // un archivo dañado no modifica el grafo
+    std::remove(archivo);
+    assert(!densaCargada.load(archivo));
+    cout << "5. grafos dirigidos, densos, datos string y archivos inválidos: OK" << endl;
+
+    std::cout << "--- Fin de la Prueba de Instantáneas Binarias ---" << std::endl;
+}
+
+// Prueba del cargador por bloques de listas de aristas en texto
+void pruebaCargaListaAristas() {
+    std::cout << "--- Prueba del Cargador de Listas de Aristas ---" << std::endl;
+    const char* archivo = "prueba_aristas.txt";
+
+    // 1. Casos de formato con un bloque mínimo (64 bytes) para forzar líneas partidas entre bloques
+    std::FILE* salida = std::fopen(archivo, "wb");
+    std::fputs("# comentario\n1 2 0.5\n2\t3\n\n% otro comentario\n3 4 1e-1\r\n-5 +6 -2.5E+1\n", salida);
+    std::fputs("7 x 1\n8\n9 10 abc\n11 12 3.25 texto ignorado\n", salida);
+    std::fputs("100000000000000000000 1 1\n13 14 7\n", salida); // entero desbordado
+    std::fputs("3000000000 1 1\n1 -3000000000\n15 16", salida); // fuera del rango de int y última línea sin salto
+    std::fclose(salida);
+    NonDirectedGraph<int> chico;
+    EdgeListLoader<int> cargadorChico(64);
+    assert(cargadorChico.load(archivo, chico));
+    const EdgeListStats& est = cargadorChico.getStats();
+    assert(est.parsedEdges == 7 && est.skippedLines == 6 && est.lines == 16);
+    assert(chico.getEdgeCount() == 7 && chico.getVertexCount() == 12);
+    assert(!chico.containsVertex(static_cast<int>(3000000000UL)) && chico.containsEdge(15, 16));
+    assert(abs(chico.edgeWeight(2, 1) - 0.5) < 1e-12 && abs(chico.edgeWeight(2, 3) - 1.0) < 1e-12);
+    assert(abs(chico.edgeWeight(4, 3) - 0.1) < 1e-12 && abs(chico.edgeWeight(-5, 6) + 25.0) < 1e-12);
+    assert(abs(chico.edgeWeight(11, 12) - 3.25) < 1e-12 && abs(chico.edgeWeight(13, 14) - 7.0) < 1e-12);
+    assert(!chico.containsVertex(7) && !cargadorChico.load("no_existe.txt", chico));
+    // con un tipo de 64 bits los mismos identificadores son válidos
+    NonDirectedGraph<long> largo;
+    EdgeListLoader<long> cargadorLargo(64);
+    assert(cargadorLargo.load(archivo, largo) && largo.containsEdge(3000000000L, 1) && largo.containsEdge(1, -3000000000L));
+    cout << "1. comentarios, pesos opcionales, exponentes, CRLF, líneas inválidas e identificadores fuera de rango: OK" << endl;
+
+    // 2. Archivo grande: cargador por bloques frente a iostream + addEdge
+    int numVertices = 300000;
+    int numAristas = 2000000;
+    unsigned long semilla = 515;
+    salida = std::fopen(archivo, "wb");
+    for (int i = 0; i < numAristas; ++i) {
+        int a = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        int b = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        std::fprintf(salida, "%d %d %d.%02d\n", a, b, i % 100, i % 97);
+    }
+    std::fclose(salida);
+
+    NonDirectedGraph<int> porFlujo;
+    double start_time = getMilliseconds();
+    std::ifstream entrada(archivo);
+    int a, b;
+    double w;
+    while (entrada >> a >> b >> w) {
+        porFlujo.addVertex(a);
+        porFlujo.addVertex(b);
+        porFlujo.addEdge(a, b, w);
+    }
+    double tiempoFlujo = getMilliseconds() - start_time;
+
+    NonDirectedGraph<int> porBloques;
+    EdgeListLoader<int> cargador;
+    assert(cargador.load(archivo, porBloques));
+    const EdgeListStats& grande = cargador.getStats();
+    cout << "2. iostream + addEdge: Tiempo: " << tiempoFlujo << " ms" << endl;
+    cout << "3. cargador por bloques: " << grande.bytes / (1024 * 1024) << " MB en " << grande.chunks << " bloques, Tiempo: "
+         << grande.seconds * 1000 << " ms (" << grande.megabytesPerSecond() << " MB/s; solo el análisis: "
+         << grande.parseMegabytesPerSecond() << " MB/s)" << endl;
+    assert(grande.parsedEdges == numAristas && grande.skippedLines == 0);
+    assert(porBloques.getEdgeCount() == porFlujo.getEdgeCount() && grande.addedEdges == porFlujo.getEdgeCount());
+    assert(porBloques.getVertexCount() == porFlujo.getVertexCount());
+    for (int i = 0; i < 1000; ++i) {
+        int v = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        int u = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        assert(porBloques.edgeWeight(v, u) == porFlujo.edgeWeight(v, u) || abs(porBloques.edgeWeight(v, u) - porFlujo.edgeWeight(v, u)) < 1e-9);
+    }
+    // con bloques pequeños cada lote cuesta según su tamaño y no según el del grafo
+    NonDirectedGraph<int> porBloquesChicos;
+    EdgeListLoader<int> cargadorChicos(64 << 10);
+    assert(cargadorChicos.load(archivo, porBloquesChicos));
+    assert(porBloquesChicos.getEdgeCount() == porBloques.getEdgeCount());
+    cout << "4. mismo archivo en " << cargadorChicos.getStats().chunks << " bloques de 64 KB: Tiempo: "
+         << cargadorChicos.getStats().seconds * 1000 << " ms (" << cargadorChicos.getStats().megabytesPerSecond() << " MB/s)" << endl;
+    std::remove(archivo);
+
+    std::cout << "--- Fin de la Prueba del Cargador de Listas de Aristas ---" << std::endl;
+}
+
+void pruebaLectoresDiferidos() {
+    std::cout << "--- Prueba de Lectores con Liberación Diferida ---" << std::endl;
+
+    // 1. Un lector recorre los vecinos de un vértice mientras se eliminan esas aristas y algunos vecinos
+    NonDirectedGraph<int> graph;
+    int grado = 100; // supera el umbral del índice hash de los vértices con muchos vecinos
+    for (int i = -grado; i <= grado; ++i) graph.addVertex(i);
+    for (int i = 1; i <= grado; ++i) {
+        graph.addEdge(0, i, i * 0.5);
+        graph.addEdge(i, i % grado + 1);
+    }
+    std::vector<int> esperado;
+    for (NonDirectedGraph<int>::NeighborCursor c = graph.neighbors(0); c.valid(); c.next()) {
+        esperado.push_back(c.target());
+    }
+    assert(static_cast<int>(esperado.size()) == grado);
+
+    std::vector<int> visitado;
+    {
+        NonDirectedGraph<int>::ReadGuard guarda(graph);
+        assert(graph.getActiveReaderCount() == 1);
+        for (NonDirectedGraph<int>::NeighborCursor c = graph.neighbors(0); c.valid(); c.next()) {
+            int v = c.target();
+            assert(abs(c.weight() - v * 0.5) < 1e-12);
+            visitado.push_back(v);
+            if (v % 3 == 0) {
+                graph.removeVertex(v); // retira el vértice, sus dos aristas de anillo y la arista hacia 0
+            } else {
+                graph.removeEdge(0, v);
+            }
+            graph.addEdge(0, -v); // las inserciones van al frente: el cursor no las ve
+        }
+        assert(visitado == esperado);
+        assert(graph.getRetiredCount() > 0);
+        // con el lector activo, reclaim no libera nada de lo que el lector pudo ver
+        assert(graph.reclaim() == 0);
+    }
+    assert(graph.getActiveReaderCount() == 0 && graph.getRetiredCount() > 0);
+    assert(graph.getDegree(0) == grado && !graph.containsVertex(3) && graph.containsVertex(-3));
+    int retirados = graph.getRetiredCount();
+    assert(graph.reclaim() == retirados && graph.getRetiredCount() == 0);
+
+    // 2. Un lector que empieza después de una eliminación no retiene sus nodos; la siguiente escritura sin lectores libera
+    {
+        NonDirectedGraph<int>::ReadGuard antiguo(graph);
+        graph.removeEdge(0, -1);
+        {
+            NonDirectedGraph<int>::ReadGuard nuevo(graph);
+            graph.removeEdge(0, -2);
+            assert(graph.getActiveReaderCount() == 2 && graph.getRetiredCount() == 4);
+        }
+        assert(graph.reclaim() == 0); // el lector antiguo pudo ver ambas eliminaciones
+    }
+    assert(graph.getRetiredCount() == 4);
+    graph.addEdge(0, -1);
+    assert(graph.getRetiredCount() == 0);
+
+    // 3. El grafo dirigido conserva el recorrido de sucesores bajo eliminación
+    DirectedGraph<int> dirigido;
+    for (int i = 0; i <= 20; ++i) dirigido.addVertex(i);
+    for (int i = 1; i <= 20; ++i) dirigido.addEdge(0, i);
+    int sucesores = 0;
+    {
+        DirectedGraph<int>::ReadGuard guarda(dirigido);
+        for (DirectedGraph<int>::NeighborCursor c = dirigido.neighbors(0); c.valid(); c.next()) {
+            dirigido.removeVertex(c.target());
+            sucesores++;
+        }
+    }
+    assert(sucesores == 20 && dirigido.getEdgeCount() == 0 && dirigido.getVertexCount() == 1);
+    dirigido.reclaim();
+    assert(dirigido.getRetiredCount() == 0);
+
+    // 4. clear, copy y renumber bajo una guarda con nodos retirados: la siguiente escritura no libera memoria ajena
+    for (int caso = 0; caso < 3; ++caso) {
+        NonDirectedGraph<int> reconstruido;
+        for (int i = 0; i < 50; ++i) reconstruido.addVertex(i);
+        for (int i = 1; i < 50; ++i) reconstruido.addEdge(0, i);
+        {
+            NonDirectedGraph<int>::ReadGuard guarda(reconstruido);
+            reconstruido.removeVertex(7);
+            reconstruido.removeEdge(0, 8);
+            assert(reconstruido.getRetiredCount() > 0);
+            if (caso == 0) {
+                reconstruido.clear();
+            } else if (caso == 1) {
+                NonDirectedGraph<int> otro;
+                otro.addVertex(1);
+                otro.addVertex(2);
+                otro.addEdge(1, 2);
+                assert(reconstruido.copy(otro) && reconstruido.getEdgeCount() == 1);
+            } else {
+                std::vector<int> orden;
+                for (int i = 0; i < reconstruido.freeze().getVertexSlots(); ++i) {
+                    if (reconstruido.containsVertexByIndex(i)) orden.push_back(i);
+                }
+                std::reverse(orden.begin(), orden.end());
+                assert(!reconstruido.renumber(orden).empty());
+            }
+            assert(reconstruido.getRetiredCount() == 0 && reconstruido.getActiveReaderCount() == 1);
+            reconstruido.removeVertex(9); // con la guarda abierta se retira, sin tocar los nodos anteriores
+        }
+        reconstruido.addVertex(1000); // sin lectores: reclaim libera solo lo retirado después de la reconstrucción
+        assert(reconstruido.getRetiredCount() == 0 && reconstruido.containsVertex(1000));
+    }
+
+    // 5. Rendimiento: recorrido completo con y sin guarda, y eliminaciones diferidas frente a inmediatas
+    NonDirectedGraph<int> grande;
+    int numVertices = 100000;
+    unsigned long semilla = 2024;
+    std::vector<NonDirectedGraph<int>::Edge> aristas;
+    for (int i = 0; i < 5 * numVertices; ++i) {
+        NonDirectedGraph<int>::Edge e;
+        e.source = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        e.destination = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        e.weight = 1.0;
+        aristas.push_back(e);
+    }
+    std::vector<int> vertices;
+    for (int i = 0; i < numVertices; ++i) vertices.push_back(i);
+    grande.addVertices(vertices.begin(), vertices.end());
+    grande.addEdges(aristas);
+
+    double inicio = getMilliseconds();
+    double sinGuarda = 0;
+    for (int v = 0; v < numVertices; ++v) {
+        for (NonDirectedGraph<int>::NeighborCursor c = grande.neighbors(v); c.valid(); c.next()) sinGuarda += c.weight();
+    }
+    double tiempoSinGuarda = getMilliseconds() - inicio;
+    inicio = getMilliseconds();
+    double conGuarda = 0;
+    {
+        NonDirectedGraph<int>::ReadGuard guarda(grande);
+        for (int v = 0; v < numVertices; ++v) {
+            for (NonDirectedGraph<int>::NeighborCursor c = grande.neighbors(v); c.valid(); c.next()) conGuarda += c.weight();
+        }
+    }
+    double tiempoConGuarda = getMilliseconds() - inicio;
+    assert(sinGuarda == conGuarda);
+    cout << "5. recorrido de " << grande.getEdgeCount() << " aristas sin guarda: " << tiempoSinGuarda
+         << " ms, con guarda: " << tiempoConGuarda << " ms" << endl;
+
+    NonDirectedGraph<int> copia(grande);
+    inicio = getMilliseconds();
+    for (int v = 0; v < numVertices; v += 2) grande.removeVertex(v);
+    double tiempoInmediato = getMilliseconds() - inicio;
+    inicio = getMilliseconds();
+    {
+        NonDirectedGraph<int>::ReadGuard guarda(copia);
+        for (int v = 0; v < numVertices; v += 2) copia.removeVertex(v);
+        retirados = copia.getRetiredCount();
+    }
+    int liberados = copia.reclaim();
+    double tiempoDiferido = getMilliseconds() - inicio;
+    assert(liberados == retirados && copia.getEdgeCount() == grande.getEdgeCount());
+    cout << "5. eliminación de " << numVertices / 2 << " vértices inmediata: " << tiempoInmediato
+         << " ms, diferida (" << retirados << " nodos retirados): " << tiempoDiferido << " ms" << endl;
+
+    std::cout << "--- Fin de la Prueba de Lectores con Liberación Diferida ---" << std::endl;
+}
+
+void pruebaPageRank() {
+    std::cout << "--- Prueba de PageRank ---" << std::endl;
+
+    // 1. Producto matriz-vector con pesos sobre el espacio de índices
+    NonDirectedGraph<int> chico;
+    for (int i = 0; i < 4; ++i) chico.addVertex(i);
+    chico.addEdge(0, 1, 2.0);
+    chico.addEdge(1, 2, 3.0);
+    chico.addEdge(2, 3, 0.5);
+    std::vector<double> x(4), y;
+    for (int i = 0; i < 4; ++i) x[chico.getIndexByData(i)] = i + 1.0;
+    const CsrView& vistaChica = chico.freeze();
+    sparseMultiply(vistaChica, x, y);
+    assert(abs(y[chico.getIndexByData(1)] - (2.0 * 1 + 3.0 * 3)) < 1e-12);
+    assert(abs(y[chico.getIndexByData(3)] - 0.5 * 3) < 1e-12);
+    sparseMultiply(vistaChica, x, y, false);
+    assert(abs(y[chico.getIndexByData(2)] - (2 + 4)) < 1e-12);
+
+    // 2. Un ciclo no dirigido tiene rango uniforme; en una estrella el centro acumula el rango
+    NonDirectedGraph<int> ciclo;
+    for (int i = 0; i < 10; ++i) ciclo.addVertex(i);
+    for (int i = 0; i < 10; ++i) ciclo.addEdge(i, (i + 1) % 10);
+    PageRankResult rc = pageRank(ciclo);
+    assert(rc.converged);
+    for (int i = 0; i < 10; ++i) assert(abs(rc.rank[ciclo.getIndexByData(i)] - 0.1) < 1e-9);
+    NonDirectedGraph<int> estrella;
+    for (int i = 0; i <= 5; ++i) estrella.addVertex(i);
+    for (int i = 1; i <= 5; ++i) estrella.addEdge(0, i, i);
+    PageRankResult re = pageRank(estrella);
+    assert(re.rank[estrella.getIndexByData(0)] > re.rank[estrella.getIndexByData(5)]);
+    assert(re.rank[estrella.getIndexByData(5)] > re.rank[estrella.getIndexByData(1)]); // más peso, más rango
+    PageRankOptions sinPesos;
+    sinPesos.weighted = false;
+    PageRankResult rs = pageRank(estrella, sinPesos);
+    assert(abs(rs.rank[estrella.getIndexByData(5)] - rs.rank[estrella.getIndexByData(1)]) < 1e-12);
+
+    // 3. Grafo dirigido con vértices sin salida y una lápida, contra la iteración densa directa
+    DirectedGraph<int> dirigido;
+    int n = 8;
+    for (int i = 0; i <= n; ++i) dirigido.addVertex(i);
+    unsigned long semilla = 7;
+    for (int i = 0; i < 20; ++i) {
+        int u = static_cast<int>(siguienteAleatorio(semilla) % n);
+        int v = static_cast<int>(siguienteAleatorio(semilla) % n);
+        if (u < 6) dirigido.addEdge(u, v, 1.0 + siguienteAleatorio(semilla) % 4); // 6 y 7 quedan sin salida
+    }
+    dirigido.addEdge(n, 0);
+    dirigido.removeVertex(n); // deja una lápida en la tabla de índices
+    PageRankResult rd = pageRank(dirigido);
+    assert(rd.converged);
+    std::vector<double> denso(n, 1.0 / n), siguiente(n);
+    for (int iter = 0; iter < 200; ++iter) {
+        double colgante = 0;
+        for (int u = 0; u < n; ++u) {
+            double total = 0;
+            for (int v = 0; v < n; ++v) total += dirigido.edgeWeight(u, v) > 0 ? dirigido.edgeWeight(u, v) : 0;
+            if (total == 0) colgante += denso[u];
+        }
+        for (int v = 0; v < n; ++v) siguiente[v] = (0.15 + 0.85 * colgante) / n;
+        for (int u = 0; u < n; ++u) {
+            double total = 0;
+            for (int v = 0; v < n; ++v) total += dirigido.edgeWeight(u, v) > 0 ? dirigido.edgeWeight(u, v) : 0;
+            for (int v = 0; v < n; ++v) {
+                if (dirigido.edgeWeight(u, v) > 0) siguiente[v] += 0.85 * denso[u] * dirigido.edgeWeight(u, v) / total;
+            }
+        }
+        denso.swap(siguiente);
+    }
+    double suma = 0;
+    for (int i = 0; i < n; ++i) {
+        assert(abs(rd.rank[dirigido.getIndexByData(i)] - denso[i]) < 1e-8);
+        suma += rd.rank[dirigido.getIndexByData(i)];
+    }
+    assert(abs(suma - 1.0) < 1e-9);
+
+    // 4. Rendimiento sobre un grafo aleatorio grande, con el tiempo de cada iteración
+    NonDirectedGraph<int> grande;
+    int numVertices = 200000;
+    std::vector<int> vertices;
+    for (int i = 0; i < numVertices; ++i) vertices.push_back(i);
+    grande.addVertices(vertices.begin(), vertices.end());
+    std::vector<NonDirectedGraph<int>::Edge> aristas;
+    for (int i = 0; i < 5 * numVertices; ++i) {
+        NonDirectedGraph<int>::Edge e;
+        e.source = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        e.destination = static_cast<int>(siguienteAleatorio(semilla) % (i % 4 == 0 ? 100 : numVertices));
+        e.weight = 1.0 + siguienteAleatorio(semilla) % 8;
+        aristas.push_back(e);
+    }
+    grande.addEdges(aristas);
+    grande.freeze();
+    PageRankOptions opciones;
+    opciones.tolerance = 1e-10;
+    PageRankResult rg = pageRank(grande, opciones);
+    suma = 0;
+    for (std::size_t i = 0; i < rg.rank.size(); ++i) suma += rg.rank[i];
+    assert(rg.converged && abs(suma - 1.0) < 1e-9);
+    cout << "4. pagerank de " << grande.getEdgeCount() << " aristas: " << rg.iterations << " iteraciones, "
+         << rg.millisecondsPerIteration() << " ms por iteración, residuo " << rg.residual << endl;
+
+    std::cout << "--- Fin de la Prueba de PageRank ---" << std::endl;
+}
+
+// Recorrido en anchura sobre las listas enlazadas del grafo (sin instantánea), resolviendo los vecinos por índice
+long recorridoListas(const NonDirectedGraph<int>& graph, int origen, std::vector<int>& nivel) {
+    nivel.assign(graph.getIndexCapacity(), -1);
+    std::vector<int> cola(1, origen);
+    nivel[graph.getIndexByData(origen)] = 0;
+    long suma = 0;
+    for (std::size_t h = 0; h < cola.size(); ++h) {
+        int u = cola[h];
+        int nu = nivel[graph.getIndexByData(u)];
+        suma += nu;
+        for (NonDirectedGraph<int>::NeighborCursor c = graph.neighbors(u); c.valid(); c.next()) {
+            if (nivel[c.targetIndex()] < 0) {
+                nivel[c.targetIndex()] = nu + 1;
+                cola.push_back(c.target());
+            }
+        }
+    }
+    return suma;
+}
+
+void pruebaReordenamiento() {
+    std::cout << "--- Prueba de Reordenamiento de Vértices ---" << std::endl;
+
+    // 1. Un camino insertado en desorden: cuthill-mckee inverso deja cada vecino a un índice de distancia
+    NonDirectedGraph<int> camino;
+    int largo = 50;
+    unsigned long semilla = 99;
+    std::vector<int> datos;
+    for (int i = 0; i < largo; ++i) datos.push_back(i);
+    for (int i = largo - 1; i > 0; --i) std::swap(datos[i], datos[siguienteAleatorio(semilla) % (i + 1)]);
+    for (int i = 0; i < largo; ++i) camino.addVertex(datos[i]);
+    for (int i = 0; i + 1 < largo; ++i) camino.addEdge(i, i + 1, i * 0.25);
+    camino.addVertex(1000);
+    camino.removeVertex(1000); // deja una lápida
+    NonDirectedGraph<int> original(camino);
+    assert(averageBandwidth(camino.freeze()) > 1.0);
+    std::vector<int> traduccion = reorder(camino, REORDER_REVERSE_CUTHILL_MCKEE);
+    assert(static_cast<int>(traduccion.size()) == largo + 1 && traduccion[largo] == -1);
+    assert(camino.getIndexCapacity() == largo && camino.getFreeIndexCount() == 0);
+    assert(averageBandwidth(camino.freeze()) == 1.0);
+    for (int i = 0; i < largo; ++i) {
+        assert(camino.getIndexByData(i) == traduccion[original.getIndexByData(i)]);
+        assert(camino.getDataByIndex(camino.getIndexByData(i)) == i);
+    }
+    for (int i = 0; i + 1 < largo; ++i) assert(camino.edgeWeight(i + 1, i) == i * 0.25);
+    assert(camino.getEdgeCount() == largo - 1 && camino.getVertexCount() == largo);
+
+    // 2. Las tres estrategias conservan el grafo; el orden por grado deja primero al vértice de mayor grado
+    ReorderStrategy estrategias[3] = {REORDER_REVERSE_CUTHILL_MCKEE, REORDER_DEGREE_DESCENDING, REORDER_BFS};
+    for (int k = 0; k < 3; ++k) {
+        NonDirectedGraph<int> g;
+        for (int i = 0; i < 200; ++i) g.addVertex(i);
+        for (int i = 0; i < 600; ++i) {
+            g.addEdge(static_cast<int>(siguienteAleatorio(semilla) % 200), static_cast<int>(siguienteAleatorio(semilla) % 200), i);
+        }
+        for (int i = 1; i < 60; ++i) g.addEdge(0, i * 3, -i); // 0 es el vértice de mayor grado
+        g.addEdge(5, 5, 2.5);
+        for (int i = 0; i < 200; i += 7) g.removeVertex(i + 1);
+        NonDirectedGraph<int> antes(g);
+        assert(!reorder(g, estrategias[k]).empty());
+        assert(g.getEdgeCount() == antes.getEdgeCount() && g.getVertexCount() == antes.getVertexCount());
+        for (int u = 0; u < 200; ++u) {
+            assert(g.containsVertex(u) == antes.containsVertex(u));
+            if (!g.containsVertex(u)) continue;
+            assert(g.getDegree(u) == antes.getDegree(u));
+            for (int v = 0; v < 200; ++v) assert(g.edgeWeight(u, v) == antes.edgeWeight(u, v));
+        }
+        if (estrategias[k] != REORDER_REVERSE_CUTHILL_MCKEE) assert(g.getIndexByData(0) == 0);
+        // las listas quedan ordenadas por índice y los pesos se conservan también en las listas
+        int previo = -1;
+        for (NonDirectedGraph<int>::NeighborCursor c = g.neighbors(0); c.valid(); c.next()) {
+            assert(c.targetIndex() >= previo && c.weight() == antes.edgeWeight(0, c.target()));
+            previo = c.targetIndex();
+        }
+        g.removeEdge(5, 5);
+        g.addVertex(500);
+        g.addEdge(500, 5);
+        assert(!g.containsEdge(5, 5) && g.containsEdge(5, 500));
+    }
+
+    // 3. Grafos dirigidos y densos; un orden que no es permutación no cambia el grafo
+    DirectedGraph<int> dirigido;
+    for (int i = 0; i < 30; ++i) dirigido.addVertex(i);
+    for (int i = 0; i < 90; ++i) {
+        dirigido.addEdge(static_cast<int>(siguienteAleatorio(semilla) % 30), static_cast<int>(siguienteAleatorio(semilla) % 30), i);
+    }
+    DirectedGraph<int> dirigidoAntes(dirigido);
+    assert(!reorder(dirigido, REORDER_BFS).empty());
+    for (int u = 0; u < 30; ++u) {
+        assert(dirigido.inDegree(u) == dirigidoAntes.inDegree(u) && dirigido.outDegree(u) == dirigidoAntes.outDegree(u));
+        for (int v = 0; v < 30; ++v) assert(dirigido.edgeWeight(u, v) == dirigidoAntes.edgeWeight(u, v));
+    }
+    DenseNonDirectedGraph<int> denso(true);
+    for (int i = 0; i < 40; ++i) denso.addVertex(i);
+    for (int i = 0; i < 40; ++i) denso.addEdge(i, (i * 7) % 40, i + 0.5);
+    DenseNonDirectedGraph<int> densoAntes(denso);
+    assert(!reorder(denso, REORDER_REVERSE_CUTHILL_MCKEE).empty());
+    for (int u = 0; u < 40; ++u) {
+        for (int v = 0; v < 40; ++v) assert(denso.edgeWeight(u, v) == densoAntes.edgeWeight(u, v));
+    }
+    assert(denso.countTriangles() == densoAntes.countTriangles());
+    std::vector<int> invalido(denso.getVertexCount(), 0);
+    unsigned long versionAntes = denso.getVersion();
+    assert(denso.renumber(invalido).empty() && denso.getVersion() == versionAntes);
+
+    // 4. Rendimiento: malla insertada en desorden, recorrido en anchura antes y después de reordenar
+    int lado = 700;
+    int numVertices = lado * lado;
+    std::vector<int> vertices;
+    for (int i = 0; i < numVertices; ++i) vertices.push_back(i);
+    for (int i = numVertices - 1; i > 0; --i) std::swap(vertices[i], vertices[siguienteAleatorio(semilla) % (i + 1)]);
+    std::vector<NonDirectedGraph<int>::Edge> aristas;
+    for (int i = 0; i < numVertices; ++i) {
+        NonDirectedGraph<int>::Edge e;
+        e.source = i;
+        e.weight = 1.0;
+        if (i % lado + 1 < lado) { e.destination = i + 1; aristas.push_back(e); }
+        if (i + lado < numVertices) { e.destination = i + lado; aristas.push_back(e); }
+    }
+    for (int i = static_cast<int>(aristas.size()) - 1; i > 0; --i) {
+        std::swap(aristas[i], aristas[siguienteAleatorio(semilla) % (i + 1)]);
+    }
+    NonDirectedGraph<int> malla;
+    for (int i = 0; i < numVertices; ++i) malla.addVertex(vertices[i]);
+    for (std::size_t i = 0; i < aristas.size(); ++i) malla.addEdge(aristas[i].source, aristas[i].destination);
+
+    ReorderStrategy medidas[4] = {REORDER_REVERSE_CUTHILL_MCKEE, REORDER_BFS, REORDER_DEGREE_DESCENDING, REORDER_REVERSE_CUTHILL_MCKEE};
+    const char* nombres[4] = {"inserción", "cuthill-mckee inverso", "anchura", "grado descendente"};
+    long referencia = -1;
+    for (int k = 0; k < 4; ++k) {
+        NonDirectedGraph<int> g(malla);
+        double inicio = getMilliseconds();
+        if (k > 0) reorder(g, medidas[k - 1]);
+        double tiempoReordenar = getMilliseconds() - inicio;
+        const CsrView& vista = g.freeze();
+        inicio = getMilliseconds();
+        BfsResult r;
+        for (int rep = 0; rep < 5; ++rep) r = breadthFirstSearch(vista, g.getIndexByData(0), 0, 0);
+        double tiempoCsr = (getMilliseconds() - inicio) / 5;
+        std::vector<int> nivel;
+        inicio = getMilliseconds();
+        long suma = 0;
+        for (int rep = 0; rep < 5; ++rep) suma = recorridoListas(g, 0, nivel);
+        double tiempoListas = (getMilliseconds() - inicio) / 5;
+        if (referencia < 0) referencia = suma;
+        assert(suma == referencia && r.distance[g.getIndexByData(numVertices - 1)] == 2 * (lado - 1));
+        cout << "4. orden de " << nombres[k] << ": ancho de banda medio " << averageBandwidth(vista)
+             << ", reordenar: " << tiempoReordenar << " ms, bfs csr: " << tiempoCsr
+             << " ms, bfs listas: " << tiempoListas << " ms" << endl;
+    }
+
+    std::cout << "--- Fin de la Prueba de Reordenamiento de Vértices ---" << std::endl;
+}
+
+void pruebaAdyacenciaComprimida() {
+    std::cout << "--- Prueba de Adyacencia Comprimida (Diferencias + Varint) ---" << std::endl;
+
+    // 1. Filas con lazos, vecinos repetidos en grafos dirigidos, índices lejanos y pesos
+    DirectedGraph<int> chico;
+    for (int i = 0; i < 300; ++i) chico.addVertex(i);
+    chico.addEdge(5, 5, 1.5);
+    chico.addEdge(5, 0, 2.0);
+    chico.addEdge(5, 299, -3.25);
+    chico.addEdge(299, 1, 1000.0);
+    chico.addEdge(200, 100, 0.001);
+    chico.removeVertex(7); // la lápida queda con fila vacía
+    const CsrView& vistaChica = chico.freeze();
+    CompressedAdjacency exacta(vistaChica, WEIGHTS_EXACT);
+    CompressedAdjacency cuantizada(vistaChica, WEIGHTS_QUANTIZED);
+    CompressedAdjacency simple(vistaChica, WEIGHTS_FLOAT);
+    CompressedAdjacency sinPesos(vistaChica);
+    assert(exacta.getVertexSlots() == vistaChica.getVertexSlots() && exacta.getEntryCount() == vistaChica.getEntryCount());
+    double paso = (1000.0 + 3.25) / 65535.0;
+    for (int u = 0; u < vistaChica.getVertexSlots(); ++u) {
+        assert(exacta.degree(u) == vistaChica.degree(u));
+        std::vector<int> fila;
+        exacta.decodeRow(u, fila);
+        for (int k = 0; k < vistaChica.degree(u); ++k) {
+            int e = vistaChica.edgeBegin(u) + k;
+            assert(fila[k] == vistaChica.target(e));
+            assert(exacta.weight(u, k) == vistaChica.weight(e));
+            assert(abs(cuantizada.weight(u, k) - vistaChica.weight(e)) <= paso / 2 + 1e-12);
+            assert(simple.weight(u, k) == static_cast<float>(vistaChica.weight(e)));
+            assert(sinPesos.weight(u, k) == 1.0);
+        }
+    }
+    assert(exacta.edgeWeight(chico.getIndexByData(5), chico.getIndexByData(299)) == -3.25);
+    assert(!exacta.containsEdge(chico.getIndexByData(299), chico.getIndexByData(5)));
+    CompressedAdjacency vacia((CsrView()));
+    assert(vacia.getVertexSlots() == 0 && vacia.getEntryCount() == 0);
+
+    // 2. Memoria y recorrido en anchura frente a la instantánea csr y a las listas de nodos
+    int numVertices = 1 << 19;
+    int numAristas = 8 * numVertices;
+    unsigned long semilla = 4242;
+    std::vector<NonDirectedGraph<int>::Edge> aristas;
+    for (int i = 0; i < numAristas; ++i) {
+        NonDirectedGraph<int>::Edge e;
+        e.source = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        // mezcla de vecinos cercanos y lejanos, como en una red con comunidades
+        int salto = (i % 4 == 0) ? static_cast<int>(siguienteAleatorio(semilla) % numVertices)
+                                 : static_cast<int>(siguienteAleatorio(semilla) % 64);
+        e.destination = (e.source + salto) % numVertices;
+        e.weight = 1.0 + siguienteAleatorio(semilla) % 100;
+        aristas.push_back(e);
+    }
+    NonDirectedGraph<int> grande;
+    std::vector<int> vertices;
+    for (int i = 0; i < numVertices; ++i) vertices.push_back(i);
+    grande.addVertices(vertices.begin(), vertices.end());
+    grande.addEdges(aristas);
+    const CsrView& vista = grande.freeze();
+
+    double inicio = getMilliseconds();
+    CompressedAdjacency comprimida(vista, WEIGHTS_QUANTIZED);
+    double tiempoComprimir = getMilliseconds() - inicio;
+    double bytesListas = static_cast<double>(vista.getEntryCount()) * sizeof(AdjacentNode<int>);
+    double bytesCsr = static_cast<double>(vista.getEntryCount()) * (sizeof(int) + sizeof(double))
+                    + (vista.getVertexSlots() + 1.0) * sizeof(int);
+    double bytesComprimidos = static_cast<double>(comprimida.getMemoryBytes());
+    cout << "2. " << vista.getEntryCount() << " entradas: listas " << bytesListas / (1024 * 1024) << " MB, csr "
+         << bytesCsr / (1024 * 1024) << " MB, comprimida " << bytesComprimidos / (1024 * 1024) << " MB (adyacencia "
+         << comprimida.getAdjacencyBytes() / (1024.0 * 1024.0) << " MB), " << bytesListas / bytesComprimidos
+         << "x menos que las listas; comprimir: " << tiempoComprimir << " ms" << endl;
+    assert(bytesListas / bytesComprimidos >= 5.0);
+
+    for (int modo = 0; modo < 2; ++modo) {
+        int alpha = modo == 0 ? 0 : bfsDefaultAlpha;
+        BfsResult rc, rz;
+        double tiempoCsr = 0.0;
+        double tiempoComprimida = 0.0;
+        for (int r = 0; r < 5; ++r) { // mejor de cinco, alternando las dos representaciones
+            inicio = getMilliseconds();
+            rc = breadthFirstSearch(vista, 0, alpha);
+            double tiempo = getMilliseconds() - inicio;
+            if (r == 0 || tiempo < tiempoCsr) tiempoCsr = tiempo;
+            inicio = getMilliseconds();
+            rz = breadthFirstSearch(comprimida, 0, alpha);
+            tiempo = getMilliseconds() - inicio;
+            if (r == 0 || tiempo < tiempoComprimida) tiempoComprimida = tiempo;
+        }
+        assert(rc.distance == rz.distance && rc.parent == rz.parent && rc.reached == rz.reached);
+        cout << "2. bfs " << (modo == 0 ? "descendente" : "con cambio de dirección") << ": csr " << tiempoCsr
+             << " ms, comprimida " << tiempoComprimida << " ms (" << tiempoComprimida / tiempoCsr << "x)" << endl;
+    }
+
+    std::cout << "--- Fin de la Prueba de Adyacencia Comprimida ---" << std::endl;
+}
+
+// Bytes por arista de un grafo no dirigido con el tipo de peso W, medidos sobre los nodos adyacentes en uso
+template <typename W>
+void reportarMemoriaPorArista(const char* nombre, const std::vector<NonDirectedGraph<int>::Edge>& aristas, int numVertices) {
+    NonDirectedGraph<int, W> g;
+    std::vector<int> vertices;
+    for (int i = 0; i < numVertices; ++i) vertices.push_back(i);
+    g.addVertices(vertices.begin(), vertices.end());
+    std::vector<typename NonDirectedGraph<int, W>::Edge> convertidas;
+    for (std::size_t i = 0; i < aristas.size(); ++i) {
+        convertidas.push_back(typename NonDirectedGraph<int, W>::Edge(aristas[i].source, aristas[i].destination, W(aristas[i].weight)));
+    }
+    double inicio = getMilliseconds();
+    g.addEdges(convertidas);
+    double tiempo = getMilliseconds() - inicio;
+    assert(g.getAdjacencyBytes() == 2 * g.getEdgeCount() * sizeof(AdjacentNode<int, W>));
+    cout << "4. W = " << nombre << ": " << sizeof(AdjacentNode<int, W>) << " bytes por mitad, "
+         << static_cast<double>(g.getAdjacencyBytes()) / g.getEdgeCount() << " bytes por arista, "
+         << g.getAdjacencyBytes() / (1024.0 * 1024.0) << " MB para " << g.getEdgeCount() << " aristas (addEdges: "
+         << tiempo << " ms)" << endl;
+}
+
+void pruebaPesosGenericos() {
+    std::cout << "--- Prueba de Tipos de Peso Genéricos ---" << std::endl;
+
+    // 1. Peso unitario: no ocupa memoria y los algoritmos funcionan igual
+    assert(sizeof(AdjacentNode<int, UnitWeight>) == 4 * sizeof(void*));
+    assert(sizeof(AdjacentNode<int, UnitWeight>) < sizeof(AdjacentNode<int, double>));
+    assert(sizeof(OptionalWeight<UnitWeight>) == sizeof(bool));
+    NonDirectedGraph<int, UnitWeight> unitario;
+    for (int i = 0; i < 6; ++i) unitario.addVertex(i);
+    for (int i = 0; i < 5; ++i) unitario.addEdge(i, i + 1, 7.5); // el peso se descarta
+    unitario.addEdge(0, 5);
+    assert(unitario.edgeWeight(2, 3) == 1.0 && unitario.edgeWeight(0, 3) == -1.0);
+    assert(unitario.findEdgeWeight(0, 5).found() && !unitario.findEdgeWeight(0, 3).found());
+    NonDirectedGraph<int, UnitWeight> copiaUnitaria(unitario);
+    copiaUnitaria.removeVertex(5);
+    assert(copiaUnitaria.getEdgeCount() == 4 && unitario.getEdgeCount() == 6);
+    ShortestPathResult caminos = dijkstra(unitario, 0);
+    assert(caminos.distance[unitario.getIndexByData(3)] == 3.0 && caminos.distance[unitario.getIndexByData(4)] == 2.0);
+    BfsResult anchura = breadthFirstSearch(unitario, 0);
+    assert(anchura.distance[unitario.getIndexByData(3)] == 3);
+    assert(connectedComponents(copiaUnitaria).count == 1);
+    const char* archivo = "prueba_pesos.bin";
+    assert(unitario.save(archivo));
+    NonDirectedGraph<int, UnitWeight> cargado;
+    assert(cargado.load(archivo) && cargado.getEdgeCount() == 6 && cargado.containsEdge(5, 0));
+    std::remove(archivo);
+
+    // 2. Pesos enteros pequeños: la ausencia se distingue de un peso -1 sin valores especiales
+    NonDirectedGraph<int, int> enteros;
+    for (int i = 0; i < 4; ++i) enteros.addVertex(i);
+    enteros.addEdge(0, 1, -1);
+    enteros.addEdge(1, 2, 40);
+    assert(enteros.edgeWeight(0, 1) == -1.0 && enteros.edgeWeight(0, 2) == -1.0); // ambiguo con edgeWeight
+    OptionalWeight<int> presente = enteros.findEdgeWeight(1, 0);
+    OptionalWeight<int> ausente = enteros.findEdgeWeight(0, 2);
+    assert(presente.found() && presente.value() == -1 && !ausente.found() && ausente.valueOr(0) == 0);
+    assert(enteros.findEdgeWeight(2, 1).value() == 40);
+    NonDirectedGraph<int, int>::ReadGuard guarda(enteros);
+    int sumaPesos = 0;
+    for (NonDirectedGraph<int, int>::NeighborCursor c = enteros.neighbors(1); c.valid(); c.next()) sumaPesos += c.weight();
+    assert(sumaPesos == 39);
+
+    // 3. Otros grafos con pesos reducidos
+    DirectedGraph<int, float> dirigido;
+    for (int i = 0; i < 3; ++i) dirigido.addVertex(i);
+    dirigido.addEdge(0, 1, 0.5f);
+    dirigido.addEdge(1, 2, 2.25f);
+    assert(dirigido.findEdgeWeight(0, 1).value() == 0.5f && !dirigido.findEdgeWeight(1, 0).found());
+    assert(dijkstra(dirigido, 0).distance[dirigido.getIndexByData(2)] == 2.75);
+    DenseNonDirectedGraph<int, unsigned char> denso(true);
+    for (int i = 0; i < 100; ++i) denso.addVertex(i);
+    for (int i = 0; i < 99; ++i) denso.addEdge(i, i + 1, static_cast<unsigned char>(i));
+    assert(denso.findEdgeWeight(51, 50).value() == 50 && !denso.findEdgeWeight(0, 2).found());
+    assert(denso.edgeWeight(98, 99) == 98.0);
+    DenseNonDirectedGraph<int, unsigned char> densoCopia(denso);
+    assert(reorder(densoCopia, REORDER_BFS).size() == 100 && densoCopia.findEdgeWeight(10, 11).value() == 10);
+    DenseNonDirectedGraph<int, double> densoDoble(true);
+    assert(densoDoble.getMatrixBytes() == 0);
+    densoDoble.addVertex(0);
+    assert(denso.getMatrixBytes() < densoDoble.getMatrixBytes());
+
+    // 4. Memoria por arista de cada instanciación (los pesos de 4 bytes o menos se alinean a 8 junto con los punteros)
+    int numVertices = 100000;
+    unsigned long semilla = 77;
+    std::vector<NonDirectedGraph<int>::Edge> aristas;
+    for (int i = 0; i < 10 * numVertices; ++i) {
+        aristas.push_back(NonDirectedGraph<int>::Edge(static_cast<int>(siguienteAleatorio(semilla) % numVertices),
+                                                      static_cast<int>(siguienteAleatorio(semilla) % numVertices),
+                                                      static_cast<double>(siguienteAleatorio(semilla) % 200)));
+    }
+    reportarMemoriaPorArista<double>("double", aristas, numVertices);
+    reportarMemoriaPorArista<float>("float", aristas, numVertices);
+    reportarMemoriaPorArista<int>("int", aristas, numVertices);
+    reportarMemoriaPorArista<unsigned char>("unsigned char", aristas, numVertices);
+    reportarMemoriaPorArista<UnitWeight>("UnitWeight", aristas, numVertices);
+
+    std::cout << "--- Fin de la Prueba de Tipos de Peso Genéricos ---" << std::endl;
+}
+
+void pruebaBfsMultiOrigen() {
+    std::cout << "--- Prueba de BFS Multi-Origen con Paralelismo de Bits ---" << std::endl;
+
+    // 1. Coincide con un recorrido por origen, con lotes parciales, origenes repetidos e inexistentes
+    NonDirectedGraph<int> graph;
+    int numVertices = 5000;
+    unsigned long semilla = 321;
+    for (int i = 0; i < numVertices; ++i) graph.addVertex(i);
+    for (int i = 0; i < 3 * numVertices; ++i) {
+        graph.addEdge(static_cast<int>(siguienteAleatorio(semilla) % (numVertices - 100)),
+                      static_cast<int>(siguienteAleatorio(semilla) % (numVertices - 100))); // los últimos 100 quedan aislados
+    }
+    graph.removeVertex(17); // lápida
+    std::vector<int> origenes;
+    for (int k = 0; k < 150; ++k) origenes.push_back(static_cast<int>(siguienteAleatorio(semilla) % numVertices));
+    origenes.push_back(origenes[3]);
+    origenes.push_back(17); // eliminado
+    origenes.push_back(numVertices - 1); // aislado
+    for (int lote = 0; lote < 3; ++lote) {
+        int tamano = lote == 0 ? 64 : (lote == 1 ? 100 : msBfsMaxBatch);
+        MultiSourceBfsResult r = multiSourceBfs(graph, origenes, true, tamano);
+        assert(r.batches == (static_cast<int>(origenes.size()) + tamano - 1) / tamano);
+        for (std::size_t k = 0; k < origenes.size(); ++k) {
+            BfsResult uno = breadthFirstSearch(graph, origenes[k]);
+            long suma = 0;
+            for (int v = 0; v < r.slots; ++v) {
+                assert(r.getDistance(static_cast<int>(k), v) == uno.distance[v]);
+                if (uno.distance[v] > 0) suma += uno.distance[v];
+            }
+            assert(r.reached[k] == uno.reached && r.distanceSum[k] == suma);
+        }
+    }
+    MultiSourceBfsResult agregados = multiSourceBfs(graph, origenes, false);
+    assert(agregados.distance.empty() && agregados.reached[origenes.size() - 2] == 0);
+    assert(agregados.reached[origenes.size() - 1] == 1 && agregados.closeness[origenes.size() - 1] == 0.0);
+    assert(agregados.closeness[3] == agregados.closeness[origenes.size() - 3] && agregados.closeness[3] > 0);
+
+    // 2. Rendimiento: 512 orígenes juntos frente a 512 recorridos independientes
+    NonDirectedGraph<int> grande;
+    int n = 1 << 17;
+    std::vector<int> vertices;
+    for (int i = 0; i < n; ++i) vertices.push_back(i);
+    grande.addVertices(vertices.begin(), vertices.end());
+    std::vector<NonDirectedGraph<int>::Edge> aristas;
+    for (int i = 0; i < 8 * n; ++i) {
+        aristas.push_back(NonDirectedGraph<int>::Edge(static_cast<int>(siguienteAleatorio(semilla) % n),
+                                                      static_cast<int>(siguienteAleatorio(semilla) % n)));
+    }
+    grande.addEdges(aristas);
+    const CsrView& vista = grande.freeze();
+    std::vector<int> muchos;
+    for (int k = 0; k < msBfsMaxBatch; ++k) muchos.push_back(static_cast<int>(siguienteAleatorio(semilla) % n));
+
+    double inicio = getMilliseconds();
+    MultiSourceBfsResult conjunto = multiSourceBfs(vista, muchos, false);
+    double tiempoConjunto = getMilliseconds() - inicio;
+    inicio = getMilliseconds();
+    std::vector<long> sumas(muchos.size(), 0);
+    for (std::size_t k = 0; k < muchos.size(); ++k) {
+        BfsResult uno = breadthFirstSearch(vista, muchos[k], 0);
+        for (int v = 0; v < n; ++v) if (uno.distance[v] > 0) sumas[k] += uno.distance[v];
+    }
+    double tiempoDescendente = getMilliseconds() - inicio;
+    inicio = getMilliseconds();
+    for (std::size_t k = 0; k < muchos.size(); ++k) breadthFirstSearch(vista, muchos[k]);
+    double tiempoDireccional = getMilliseconds() - inicio;
+    for (std::size_t k = 0; k < muchos.size(); ++k) assert(sumas[k] == conjunto.distanceSum[k]);
+    cout << "2. " << muchos.size() << " orígenes sobre " << grande.getEdgeCount() << " aristas: ms-bfs " << tiempoConjunto
+         << " ms, bfs descendente por origen " << tiempoDescendente << " ms, bfs direccional por origen "
+         << tiempoDireccional << " ms (" << tiempoDescendente / tiempoConjunto << "x)" << endl;
+    inicio = getMilliseconds();
+    multiSourceBfs(vista, muchos, false, 64);
+    cout << "2. mismos orígenes en lotes de 64: " << getMilliseconds() - inicio << " ms" << endl;
+
+    std::cout << "--- Fin de la Prueba de BFS Multi-Origen ---" << std::endl;
+}
+
+void pruebaTriangulosYNucleos() {
+    std::cout << "--- Prueba de Conteo de Triángulos y K-Núcleos ---" << std::endl;
+
+    // 1. Coincide con la matriz densa y con un conteo por fuerza bruta, con lazos y una lápida
+    NonDirectedGraph<int> graph;
+    DenseNonDirectedGraph<int> densa;
+    int numVertices = 300;
+    unsigned long semilla = 777;
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addVertex(i);
+        densa.addVertex(i);
+    }
+    for (int i = 0; i < 6 * numVertices; ++i) {
+        int a = static_cast<int>(siguienteAleatorio(semilla) % numVertices);
+        int b = static_cast<int>(siguienteAleatorio(semilla) % (a < 40 ? numVertices : 60)); // los primeros 60 concentran aristas
+        graph.addEdge(a, b);
+        densa.addEdge(a, b);
+    }
+    graph.addEdge(5, 5);
+    graph.removeVertex(7);
+    densa.removeVertex(7);
+    TriangleResult t = countTriangles(graph);
+    assert(t.total == densa.countTriangles() && t.total > 0);
+    long total = 0;
+    for (int u = 0; u < numVertices; ++u) {
+        int iu = graph.getIndexByData(u);
+        if (iu < 0) continue;
+        long propios = 0;
+        int grado = 0;
+        for (int v = 0; v < numVertices; ++v) {
+            if (v == u || !graph.containsEdge(u, v)) continue;
+            grado++;
+            for (int w = v + 1; w < numVertices; ++w) {
+                if (w != u && graph.containsEdge(u, w) && graph.containsEdge(v, w)) propios++;
+            }
+        }
+        assert(t.perVertex[iu] == propios);
+        assert(grado < 2 || std::fabs(t.clustering[iu] - propios / (grado * (grado - 1) / 2.0)) < 1e-12);
+        total += propios;
+    }
+    assert(total == 3 * t.total && t.transitivity > 0 && t.averageClustering > 0);
+
+    // núcleos por eliminación repetida: el k-núcleo es lo que queda al quitar vértices de grado menor que k
+    CoreResult c = coreDecomposition(graph);
+    const CsrView& vista = graph.freeze();
+    int slots = vista.getVertexSlots();
+    std::vector<int> esperado(slots, -1);
+    for (int k = 0; ; ++k) {
+        std::vector<bool> vivo(slots, false);
+        for (int v = 0; v < slots; ++v) vivo[v] = graph.containsVertexByIndex(v);
+        bool cambio = true;
+        while (cambio) {
+            cambio = false;
+            for (int v = 0; v < slots; ++v) {
+                if (!vivo[v]) continue;
+                int grado = 0;
+                for (int e = vista.edgeBegin(v); e < vista.edgeEnd(v); ++e) {
+                    if (vista.target(e) != v && vivo[vista.target(e)]) grado++;
+                }
+                if (grado < k) {
+                    vivo[v] = false;
+                    cambio = true;
+                }
+            }
+        }
+        bool quedan = false;
+        for (int v = 0; v < slots; ++v) {
+            if (vivo[v]) {
+                esperado[v] = k;
+                quedan = true;
+            }
+        }
+        if (!quedan) break;
+    }
+    for (int v = 0; v < slots; ++v) assert(c.core[v] == esperado[v]);
+    assert(static_cast<int>(c.order.size()) == graph.getVertexCount() && c.coreSize(c.maxCore) > c.maxCore);
+    assert(c.core[graph.getIndexByData(5)] >= 0 && c.coreSize(0) == graph.getVertexCount());
+    cout << "1. " << t.total << " triángulos y degeneración " << c.maxCore << " sobre " << graph.getEdgeCount()
+         << " aristas: OK" << endl;
+
+    // 2. Rendimiento en un grafo de ley de potencias (enlace preferencial con cierre de triángulos)
+    NonDirectedGraph<int> grande;
+    int n = 200000;
+    int aristasPorVertice = 8;
+    std::vector<int> extremos; // cada vértice aparece tantas veces como su grado
+    std::vector<std::vector<int> > vecinos(n);
+    std::vector<NonDirectedGraph<int>::Edge> aristas;
+    std::vector<int> vertices;
+    for (int i = 0; i < n; ++i) vertices.push_back(i);
+    grande.addVertices(vertices.begin(), vertices.end());
+    for (int v = 1; v < n; ++v) {
+        int anterior = -1;
+        for (int k = 0; k < aristasPorVertice && k < v; ++k) {
+            // la mitad de las veces se une a un vecino del destino anterior, lo que cierra un triángulo
+            int destino = anterior >= 0 && (siguienteAleatorio(semilla) & 1)
+                ? vecinos[anterior][siguienteAleatorio(semilla) % vecinos[anterior].size()]
+                : (extremos.empty() ? 0 : extremos[siguienteAleatorio(semilla) % extremos.size()]);
+            if (destino == v) continue;
+            aristas.push_back(NonDirectedGraph<int>::Edge(v, destino));
+            extremos.push_back(v);
+            extremos.push_back(destino);
+            vecinos[v].push_back(destino);
+            vecinos[destino].push_back(v);
+            anterior = destino;
+        }
+    }
+    grande.addEdges(aristas);
+    const CsrView& vistaGrande = grande.freeze();
+    int maxGrado = 0;
+    for (int v = 0; v < vistaGrande.getVertexSlots(); ++v) {
+        if (vistaGrande.degree(v) > maxGrado) maxGrado = vistaGrande.degree(v);
+    }
+
+    double inicio = getMilliseconds();
+    TriangleResult rapido = countTriangles(vistaGrande);
+    double tiempoOrientado = getMilliseconds() - inicio;
+    // referencia sin orientar: cada arista u < v intersecta las filas completas y cuenta los w > v
+    inicio = getMilliseconds();
+    long referencia = 0;
+    for (int u = 0; u < vistaGrande.getVertexSlots(); ++u) {
+        for (int e = vistaGrande.edgeBegin(u); e < vistaGrande.edgeEnd(u); ++e) {
+            int v = vistaGrande.target(e);
+            if (v <= u) continue;
+            int i = vistaGrande.edgeBegin(u);
+            int j = vistaGrande.edgeBegin(v);
+            while (i < vistaGrande.edgeEnd(u) && j < vistaGrande.edgeEnd(v)) {
+                int x = vistaGrande.target(i);
+                int y = vistaGrande.target(j);
+                if (x == y) {
+                    if (x > v) referencia++;
+                    i++;
+                    j++;
+                } else if (x < y) {
+                    i++;
+                } else {
+                    j++;
+                }
+            }
+        }
+    }
+    double tiempoReferencia = getMilliseconds() - inicio;
+    assert(referencia == rapido.total);
+    cout << "2. " << rapido.total << " triángulos en " << grande.getEdgeCount() << " aristas (grado máximo " << maxGrado
+         << "): orientado por grado " << tiempoOrientado << " ms, intersección de filas completas " << tiempoReferencia
+         << " ms (" << tiempoReferencia / tiempoOrientado << "x); transitividad " << rapido.transitivity << endl;
+
+    inicio = getMilliseconds();
+    CoreResult nucleos = coreDecomposition(vistaGrande);
+    cout << "2. k-núcleos: degeneración " << nucleos.maxCore << " (" << nucleos.coreSize(nucleos.maxCore)
+         << " vértices en el núcleo máximo): " << getMilliseconds() - inicio << " ms" << endl;
+
+    std::cout << "--- Fin de la Prueba de Triángulos y K-Núcleos ---" << std::endl;
+}
+
+void pruebaBosqueGenerador() {
+    std::cout << "--- Prueba de Bosque Generador Mínimo (Boruvka y Kruskal) ---" << std::endl;
+
+    // 1. Ejemplo con solución conocida: dos componentes y un vértice aislado
+    NonDirectedGraph<int> chico;
+    for (int i = 0; i < 7; ++i) chico.addVertex(i);
+    chico.addEdge(0, 1, 4.0);
+    chico.addEdge(0, 2, 1.0);
+    chico.addEdge(1, 2, 2.0);
+    chico.addEdge(1, 3, 5.0);
+    chico.addEdge(2, 3, 8.0);
+    chico.addEdge(4, 5, 3.0);
+    chico.addEdge(3, 3, 0.5); // los lazos no forman parte del bosque
+    for (int a = 0; a < 3; ++a) {
+        SpanningForestAlgorithm algoritmo = a == 0 ? SPANNING_AUTO : (a == 1 ? SPANNING_BORUVKA : SPANNING_KRUSKAL);
+        SpanningForestResult r = minimumSpanningForest(chico, algoritmo);
+        assert(r.edges.size() == 4 && r.trees == 3 && std::fabs(r.totalWeight - 11.0) < 1e-12);
+        assert(a != 0 || r.algorithm == SPANNING_KRUSKAL);
+        for (std::size_t k = 0; k < r.edges.size(); ++k) {
+            assert(r.edges[k].source < r.edges[k].destination && r.edges[k].weight != 8.0 && r.edges[k].weight != 4.0);
+        }
+    }
+
+    // 2. Ambos algoritmos dan el mismo bosque, con pesos repetidos y lápidas
+    NonDirectedGraph<int> graph;
+    int numVertices = 3000;
+    unsigned long semilla = 4242;
+    for (int i = 0; i < numVertices; ++i) graph.addVertex(i);
+    for (int i = 0; i < 4 * numVertices; ++i) {
+        int a = static_cast<int>(siguienteAleatorio(semilla) % (numVertices - 50));
+        int b = static_cast<int>(siguienteAleatorio(semilla) % (numVertices - 50));
+        graph.addEdge(a, b, static_cast<double>(siguienteAleatorio(semilla) % 20)); // muchos empates
+    }
+    for (int i = 0; i < 30; ++i) graph.removeVertex(i * 7);
+    SpanningForestResult boruvka = minimumSpanningForest(graph, SPANNING_BORUVKA);
+    SpanningForestResult kruskal = minimumSpanningForest(graph, SPANNING_KRUSKAL);
+    ComponentResult componentes = connectedComponents(graph);
+    assert(boruvka.trees == componentes.count && kruskal.trees == componentes.count);
+    assert(static_cast<int>(boruvka.edges.size()) == graph.getVertexCount() - componentes.count);
+    assert(boruvka.totalWeight == kruskal.totalWeight && boruvka.edges.size() == kruskal.edges.size());
+    std::vector<std::pair<int, int> > conjuntoB;
+    std::vector<std::pair<int, int> > conjuntoK;
+    UnionFind arbol(graph.freeze().getVertexSlots());
+    for (std::size_t k = 0; k < boruvka.edges.size(); ++k) {
+        const SpanningEdge& e = boruvka.edges[k];
+        assert(arbol.unite(e.source, e.destination)); // sin ciclos
+        assert(componentes.label[e.source] == componentes.label[e.destination]);
+        assert(graph.edgeWeight(graph.getDataByIndex(e.source), graph.getDataByIndex(e.destination)) == e.weight);
+        conjuntoB.push_back(std::make_pair(e.source, e.destination));
+        conjuntoK.push_back(std::make_pair(kruskal.edges[k].source, kruskal.edges[k].destination));
+    }
+    std::sort(conjuntoB.begin(), conjuntoB.end());
+    std::sort(conjuntoK.begin(), conjuntoK.end());
+    assert(conjuntoB == conjuntoK); // el desempate por identificador hace único al bosque
+    cout << "2. " << graph.getEdgeCount() << " aristas: bosque de " << boruvka.edges.size() << " aristas y "
+         << boruvka.trees << " árboles, peso " << boruvka.totalWeight << " en " << boruvka.rounds << " rondas: OK" << endl;
+
+    // 3. Rendimiento sobre grafos grandes y chicos
+    for (int escala = 0; escala < 2; ++escala) {
+        NonDirectedGraph<int> grande;
+        int n = escala == 0 ? 160 : 1 << 19;
+        std::vector<int> vertices;
+        for (int i = 0; i < n; ++i) vertices.push_back(i);
+        grande.addVertices(vertices.begin(), vertices.end());
+        std::vector<NonDirectedGraph<int>::Edge> aristas;
+        for (int i = 0; i < 6 * n; ++i) {
+            aristas.push_back(NonDirectedGraph<int>::Edge(static_cast<int>(siguienteAleatorio(semilla) % n),
+                                                          static_cast<int>(siguienteAleatorio(semilla) % n),
+                                                          (siguienteAleatorio(semilla) % 1000000) / 1000.0));
+        }
+        grande.addEdges(aristas);
+        const CsrView& vista = grande.freeze();
+        int repeticiones = escala == 0 ? 2000 : 1;
+        SpanningForestResult rb;
+        SpanningForestResult rk;
+        double tiempoBoruvka = 0.0;
+        double tiempoKruskal = 0.0;
+        for (int ronda = 0; ronda < 3; ++ronda) { // mejor de tres: una sola corrida mide sobre todo el ruido
+            double inicio = getMilliseconds();
+            for (int k = 0; k < repeticiones; ++k) rb = minimumSpanningForest(vista, SPANNING_BORUVKA);
+            double tiempo = (getMilliseconds() - inicio) / repeticiones;
+            if (ronda == 0 || tiempo < tiempoBoruvka) tiempoBoruvka = tiempo;
+            inicio = getMilliseconds();
+            for (int k = 0; k < repeticiones; ++k) rk = minimumSpanningForest(vista, SPANNING_KRUSKAL);
+            tiempo = (getMilliseconds() - inicio) / repeticiones;
+            if (ronda == 0 || tiempo < tiempoKruskal) tiempoKruskal = tiempo;
+        }
+        assert(std::fabs(rb.totalWeight - rk.totalWeight) < 1e-9 * rk.totalWeight && rb.edges.size() == rk.edges.size());
+        cout << "3. " << grande.getEdgeCount() << " aristas: boruvka " << tiempoBoruvka << " ms (" << rb.rounds
+             << " rondas), kruskal " << tiempoKruskal << " ms; automático elige "
+             << (minimumSpanningForest(vista).algorithm == SPANNING_KRUSKAL ? "kruskal" : "boruvka") << endl;
+    }
+
+    std::cout << "--- Fin de la Prueba de Bosque Generador Mínimo ---" << std::endl;
+}
+
+// Intermediación por fuerza bruta: distancias de Floyd-Warshall, cantidad de caminos mínimos por
+// programación dinámica y, para cada par {s, t}, la fracción de caminos que pasa por cada vértice.
+std::vector<double> intermediacionIngenua(const CsrView& vista, bool conPesos) {
+    int n = vista.getVertexSlots();
+    const double infinito = 1e300;
+    std::vector<std::vector<double> > d(n, std::vector<double>(n, infinito));
+    for (int u = 0; u < n; ++u) {
+        d[u][u] = 0.0;
+        for (int e = vista.edgeBegin(u); e < vista.edgeEnd(u); ++e) {
+            if (vista.target(e) != u) d[u][vista.target(e)] = conPesos ? vista.weight(e) : 1.0;
+        }
+    }
+    for (int k = 0; k < n; ++k)
+        for (int i = 0; i < n; ++i)
+            for (int j = 0; j < n; ++j)
+                if (d[i][k] + d[k][j] < d[i][j]) d[i][j] = d[i][k] + d[k][j];
+    std::vector<std::vector<double> > sigma(n, std::vector<double>(n, 0.0));
+    for (int s = 0; s < n; ++s) {
+        std::vector<std::pair<double, int> > porDistancia;
+        for (int t = 0; t < n; ++t) if (d[s][t] < infinito) porDistancia.push_back(std::make_pair(d[s][t], t));
+        std::sort(porDistancia.begin(), porDistancia.end());
+        sigma[s][s] = 1.0;
+        for (std::size_t i = 1; i < porDistancia.size(); ++i) {
+            int t = porDistancia[i].second;
+            for (int e = vista.edgeBegin(t); e < vista.edgeEnd(t); ++e) {
+                int u = vista.target(e);
+                if (u != t && d[s][u] + (conPesos ? vista.weight(e) : 1.0) == d[s][t]) sigma[s][t] += sigma[s][u];
+            }
+        }
+    }
+    std::vector<double> resultado(n, 0.0);
+    for (int s = 0; s < n; ++s)
+        for (int t = s + 1; t < n; ++t) {
+            if (d[s][t] >= infinito) continue;
+            for (int v = 0; v < n; ++v) {
+                if (v != s && v != t && d[s][v] + d[v][t] == d[s][t]) resultado[v] += sigma[s][v] * sigma[v][t] / sigma[s][t];
+            }
+        }
+    return resultado;
+}
+
+void pruebaIntermediacion() {
+    std::cout << "--- Prueba de Centralidad de Intermediación (Brandes) ---" << std::endl;
+
+    // 1. Valores conocidos: en un camino de n vértices, el i-ésimo está entre i (n - 1 - i) pares
+    NonDirectedGraph<int> camino;
+    for (int i = 0; i < 9; ++i) camino.addVertex(i);
+    for (int i = 0; i + 1 < 9; ++i) camino.addEdge(i, i + 1);
+    BetweennessResult r = betweennessCentrality(camino);
+    for (int i = 0; i < 9; ++i) assert(r.centrality[camino.getIndexByData(i)] == i * (8.0 - i));
+    assert(!r.sampled && r.sources.size() == 9 && r.errorBound == 0.0);
+
+    // 2. Coincide con la fuerza bruta, con y sin pesos (enteros pequeños: muchos caminos empatados)
+    NonDirectedGraph<int> graph;
+    int numVertices = 70;
+    unsigned long semilla = 9090;
+    for (int i = 0; i < numVertices; ++i) graph.addVertex(i);
+    for (int i = 0; i < 3 * numVertices; ++i) {
+        int a = static_cast<int>(siguienteAleatorio(semilla) % (numVertices - 5));
+        int b = static_cast<int>(siguienteAleatorio(semilla) % (numVertices - 5));
+        graph.addEdge(a, b, static_cast<double>(1 + siguienteAleatorio(semilla) % 3));
+    }
+    graph.removeVertex(11);
+    graph.removeVertex(12);
+    const CsrView& vista = graph.freeze();
+    for (int p = 0; p < 2; ++p) {
+        BetweennessOptions opciones;
+        opciones.weighted = p == 1;
+        BetweennessResult exacto = betweennessCentrality(graph, opciones);
+        std::vector<double> esperado = intermediacionIngenua(vista, opciones.weighted);
+        for (int v = 0; v < vista.getVertexSlots(); ++v) {
+            assert(std::fabs(exacto.centrality[v] - esperado[v]) < 1e-9 * (1.0 + esperado[v]));
+        }
+        // muestrear todos los vértices es el cálculo exacto
+        opciones.samples = graph.getVertexCount();
+        BetweennessResult todos = betweennessCentrality(graph, opciones);
+        assert(!todos.sampled && todos.centrality == exacto.centrality);
+    }
+    cout << "2. intermediación exacta con y sin pesos sobre " << graph.getEdgeCount() << " aristas: OK" << endl;
+
+    // 3. Estimación por muestreo frente al valor exacto
+    NonDirectedGraph<int> grande;
+    int n = 5000;
+    std::vector<int> vertices;
+    for (int i = 0; i < n; ++i) vertices.push_back(i);
+    grande.addVertices(vertices.begin(), vertices.end());
+    std::vector<NonDirectedGraph<int>::Edge> aristas;
+    for (int i = 0; i < 5 * n; ++i) {
+        aristas.push_back(NonDirectedGraph<int>::Edge(static_cast<int>(siguienteAleatorio(semilla) % n),
+                                                      static_cast<int>(siguienteAleatorio(semilla) % n),
+                                                      static_cast<double>(1 + siguienteAleatorio(semilla) % 10)));
+    }
+    grande.addEdges(aristas);
+    for (int p = 0; p < 2; ++p) {
+        BetweennessOptions opciones;
+        opciones.weighted = p == 1;
+        opciones.normalized = true;
+        double inicio = getMilliseconds();
+        BetweennessResult exacto = betweennessCentrality(grande, opciones);
+        double tiempoExacto = getMilliseconds() - inicio;
+        opciones.samples = betweennessSamples(0.1, n);
+        inicio = getMilliseconds();
+        BetweennessResult estimado = betweennessCentrality(grande, opciones);
+        double tiempoEstimado = getMilliseconds() - inicio;
+        double errorMaximo = 0.0;
+        for (int v = 0; v < n; ++v) {
+            double error = std::fabs(estimado.centrality[v] - exacto.centrality[v]);
+            if (error > errorMaximo) errorMaximo = error;
+        }
+        assert(estimado.sampled && static_cast<int>(estimado.sources.size()) == opciones.samples);
+        assert(estimado.errorBound <= 0.1 && errorMaximo <= estimado.errorBound);
+        cout << "3. " << (p == 1 ? "con pesos" : "sin pesos") << ", " << grande.getEdgeCount() << " aristas: exacto "
+             << tiempoExacto << " ms, " << opciones.samples << " orígenes " << tiempoEstimado << " ms; error máximo "
+             << errorMaximo << " (cota " << estimado.errorBound << ")" << endl;
+    }
+
+    std::cout << "--- Fin de la Prueba de Centralidad de Intermediación ---" << std::endl;
+}
+
+// Flujo máximo de referencia por Edmonds-Karp: caminos de aumento más cortos sobre la misma red residual.
+double flujoEdmondsKarp(ResidualNetwork& red, int origen, int sumidero) {
+    red.resetFlow();
+    int n = red.getVertexSlots();
+    double total = 0.0;
+    std::vector<int> arcoPadre(n);
+    std::vector<int> cola;
+    while (true) {
+        arcoPadre.assign(n, -1);
+        arcoPadre[origen] = -2;
+        cola.clear();
+        cola.push_back(origen);
+        for (std::size_t i = 0; i < cola.size() && arcoPadre[sumidero] == -1; ++i) {
+            int u = cola[i];
+            for (int a = red.arcBegin(u); a < red.arcEnd(u); ++a) {
+                int v = red.head(a);
+                if (arcoPadre[v] != -1 || red.residual(a) <= 0.0) continue;
+                arcoPadre[v] = a;
+                cola.push_back(v);
+            }
+        }
+        if (arcoPadre[sumidero] == -1) break;
+        double cuello = 1e300;
+        for (int v = sumidero; v != origen; v = red.head(red.reverse(arcoPadre[v]))) {
+            if (red.residual(arcoPadre[v]) < cuello) cuello = red.residual(arcoPadre[v]);
+        }
+        for (int v = sumidero; v != origen; v = red.head(red.reverse(arcoPadre[v]))) red.push(arcoPadre[v], cuello);
+        total += cuello;
+    }
+    return total;
+}
+
+// Verifica que el corte separe origen y sumidero y que su capacidad sea el valor del flujo.
+void verificarCorte(const MaxFlowResult& r, int origen, int sumidero) {
+    assert(r.sourceSide[origen] && !r.sourceSide[sumidero]);
+    double capacidad = 0.0;
+    for (std::size_t k = 0; k < r.cutEdges.size(); ++k) {
+        assert(r.sourceSide[r.cutEdges[k].source] && !r.sourceSide[r.cutEdges[k].destination]);
+        capacidad += r.cutEdges[k].capacity;
+    }
+    assert(std::fabs(capacidad - r.value) <= 1e-9 * (1.0 + r.value));
+}
+
+void pruebaFlujoMaximo() {
+    std::cout << "--- Prueba de Flujo Máximo y Corte Mínimo (Push-Relabel) ---" << std::endl;
+
+    // 1. Red clásica de seis vértices con flujo máximo 23
+    DirectedGraph<int> clasica;
+    for (int i = 0; i < 6; ++i) clasica.addVertex(i);
+    clasica.addEdge(0, 1, 16.0);
+    clasica.addEdge(0, 2, 13.0);
+    clasica.addEdge(2, 1, 4.0);
+    clasica.addEdge(1, 3, 12.0);
+    clasica.addEdge(3, 2, 9.0);
+    clasica.addEdge(2, 4, 14.0);
+    clasica.addEdge(4, 3, 7.0);
+    clasica.addEdge(3, 5, 20.0);
+    clasica.addEdge(4, 5, 4.0);
+    MaxFlowResult r = maxFlow(clasica, 0, 5);
+    assert(r.value == 23.0);
+    verificarCorte(r, clasica.getIndexByData(0), clasica.getIndexByData(5));
+    assert(maxFlow(clasica, 5, 0).value == 0.0 && maxFlow(clasica, 0, 0).value == 0.0 && maxFlow(clasica, 0, 99).value == 0.0);
+    // sin dirección cada arista lleva flujo en los dos sentidos
+    NonDirectedGraph<int> sinDireccion;
+    for (int i = 0; i < 4; ++i) sinDireccion.addVertex(i);
+    sinDireccion.addEdge(0, 1, 3.0);
+    sinDireccion.addEdge(2, 1, 2.0);
+    sinDireccion.addEdge(0, 2, 1.0);
+    sinDireccion.addEdge(3, 2, 5.0);
+    sinDireccion.addEdge(1, 1, 9.0); // lazo ignorado
+    MaxFlowResult rs = maxFlow(sinDireccion, 0, 3);
+    assert(rs.value == 3.0);
+    verificarCorte(rs, sinDireccion.getIndexByData(0), sinDireccion.getIndexByData(3));
+    cout << "1. red clásica: flujo " << r.value << " con " << r.cutEdges.size() << " aristas en el corte: OK" << endl;
+
+    // 2. Coincide con Edmonds-Karp en redes aleatorias dirigidas y no dirigidas, con lápidas
+    unsigned long semilla = 5150;
+    for (int caso = 0; caso < 40; ++caso) {
+        int n = 20 + caso * 3;
+        DirectedGraph<int> dirigido;
+        NonDirectedGraph<int> noDirigido;
+        for (int i = 0; i < n; ++i) {
+            dirigido.addVertex(i);
+            noDirigido.addVertex(i);
+        }
+        for (int i = 0; i < 4 * n; ++i) {
+            int a = static_cast<int>(siguienteAleatorio(semilla) % n);
+            int b = static_cast<int>(siguienteAleatorio(semilla) % n);
+            double capacidad = caso % 2 == 0 ? static_cast<double>(1 + siguienteAleatorio(semilla) % 20)
+                                             : (1 + siguienteAleatorio(semilla) % 1000) / 64.0; // fracciones exactas
+            dirigido.addEdge(a, b, capacidad);
+            noDirigido.addEdge(a, b, capacidad);
+        }
+        dirigido.removeVertex(n / 2);
+        noDirigido.removeVertex(n / 2);
+        for (int p = 0; p < 2; ++p) {
+            bool simetrica = p == 1;
+            const CsrView& vista = simetrica ? noDirigido.freeze() : dirigido.freeze();
+            int origen = simetrica ? noDirigido.getIndexByData(0) : dirigido.getIndexByData(0);
+            int sumidero = simetrica ? noDirigido.getIndexByData(n - 1) : dirigido.getIndexByData(n - 1);
+            ResidualNetwork red(vista, simetrica);
+            MaxFlowResult flujo = maxFlow(red, origen, sumidero);
+            assert(flujo.value == flujoEdmondsKarp(red, origen, sumidero));
+            verificarCorte(flujo, origen, sumidero);
+            MaxFlowResult otraVez = maxFlow(red, origen, sumidero); // la red se reutiliza
+            assert(otraVez.value == flujo.value && otraVez.pushes == flujo.pushes);
+        }
+    }
+    cout << "2. 40 redes aleatorias dirigidas y no dirigidas coinciden con Edmonds-Karp: OK" << endl;
+
+    // 3. Rendimiento: grilla (segmentación de imágenes) y red aleatoria dirigida
+    for (int tipo = 0; tipo < 2; ++tipo) {
+        ResidualNetwork red;
+        int origen;
+        int sumidero;
+        int vertices;
+        if (tipo == 0) {
+            // grilla de lado x lado con 4 vecinos; el origen y el sumidero se unen a la primera y la última columna
+            NonDirectedGraph<int> grilla;
+            int lado = 200;
+            vertices = lado * lado + 2;
+            std::vector<int> datos;
+            for (int i = 0; i < vertices; ++i) datos.push_back(i);
+            grilla.addVertices(datos.begin(), datos.end());
+            std::vector<NonDirectedGraph<int>::Edge> aristas;
+            for (int f = 0; f < lado; ++f) {
+                for (int c = 0; c < lado; ++c) {
+                    int v = f * lado + c;
+                    if (c + 1 < lado) aristas.push_back(NonDirectedGraph<int>::Edge(v, v + 1, static_cast<double>(1 + siguienteAleatorio(semilla) % 100)));
+                    if (f + 1 < lado) aristas.push_back(NonDirectedGraph<int>::Edge(v, v + lado, static_cast<double>(1 + siguienteAleatorio(semilla) % 100)));
+                }
+                aristas.push_back(NonDirectedGraph<int>::Edge(lado * lado, f * lado, 1000.0));
+                aristas.push_back(NonDirectedGraph<int>::Edge(f * lado + lado - 1, lado * lado + 1, 1000.0));
+            }
+            grilla.addEdges(aristas);
+            red.build(grilla.freeze(), true);
+            origen = grilla.getIndexByData(lado * lado);
+            sumidero = grilla.getIndexByData(lado * lado + 1);
+        } else {
+            DirectedGraph<int> aleatorio;
+            vertices = 1 << 17;
+            for (int i = 0; i < vertices; ++i) aleatorio.addVertex(i);
+            for (int i = 0; i < 8 * vertices; ++i) {
+                aleatorio.addEdge(static_cast<int>(siguienteAleatorio(semilla) % vertices),
+                                  static_cast<int>(siguienteAleatorio(semilla) % vertices),
+                                  static_cast<double>(1 + siguienteAleatorio(semilla) % 1000));
+            }
+            red.build(aleatorio.freeze(), false);
+            origen = aleatorio.getIndexByData(0);
+            sumidero = aleatorio.getIndexByData(vertices - 1);
+        }
+        double inicio = getMilliseconds();
+        MaxFlowResult flujo = maxFlow(red, origen, sumidero);
+        double tiempoPushRelabel = getMilliseconds() - inicio;
+        inicio = getMilliseconds();
+        double referencia = flujoEdmondsKarp(red, origen, sumidero);
+        double tiempoReferencia = getMilliseconds() - inicio;
+        assert(std::fabs(referencia - flujo.value) <= 1e-9 * flujo.value);
+        verificarCorte(flujo, origen, sumidero);
+        cout << "3. " << (tipo == 0 ? "grilla" : "red aleatoria") << " de " << vertices << " vértices y " << red.getArcCount()
+             << " arcos: flujo " << flujo.value << ", push-relabel " << tiempoPushRelabel << " ms (" << flujo.pushes
+             << " empujes, " << flujo.relabels << " reetiquetados, " << flujo.globalRelabels << " globales, " << flujo.gaps
+             << " huecos), Edmonds-Karp " << tiempoReferencia << " ms" << endl;
+    }
+
+    std::cout << "--- Fin de la Prueba de Flujo Máximo ---" << std::endl;
+}
+
+int main() {
+    std::cout << "--- Prueba de Estrés de NonDirectedGraph con Muchos Nodos (C++98) ---" << std::endl;
+
+    NonDirectedGraph<int> graph;
+    int numVertices = 10000; // Número grande de vértices
+    int numAristas = 50000; // Número grande de aristas
+
+    // 1. Prueba de addVertex con muchos vértices
+    double start_time = getMilliseconds();
+    for (int i = 0; i < numVertices; ++i) {
+        graph.addVertex(i);
+        assert(graph.containsVertex(i));
+    }
+    double end_time = getMilliseconds();
+    cout << "1. addVertex con " << numVertices << " vértices: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getVertexCount() == numVertices);
+
+    // 2. Prueba de addEdge con muchas aristas
+    start_time = getMilliseconds();
+    for (int i = 0; i < numAristas; ++i) {
+        int source = i % numVertices;         // Distribución simple de las aristas: cada vuelta
+        int dest = (i + i / numVertices + 1) % numVertices; // conecta con un salto distinto para no repetir aristas.
+        double weight = (i % 100) / 10.0; // Peso entre 0.0 y 9.9
+        graph.addEdge(source, dest, weight);
+        if (!graph.containsEdge(source,dest)){
+           cout << "ERROR: No se agrego la arista " << source << " <-> " << dest << endl;
+        }
+        assert(graph.containsEdge(source, dest));
+        assert(graph.containsEdge(dest, source));
+        assert(abs(graph.edgeWeight(source, dest) - weight) < 0.0001);
+        assert(abs(graph.edgeWeight(dest, source) - weight) < 0.0001);
+    }
+    end_time = getMilliseconds();
+    cout << "2. addEdge con " << numAristas << " aristas: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getEdgeCount() == numAristas);
+
+    // 3. Prueba de removeEdge con muchas aristas
+    start_time = getMilliseconds();
+    for (int i = 0; i < numAristas / 2; ++i) { // Eliminar la mitad de las aristas
+        int source = i % numVertices;
+        int dest = (i + i / numVertices + 1) % numVertices;
+        if (graph.containsEdge(source, dest)) { // Importante verificar antes de eliminar
+            graph.removeEdge(source, dest);
+            assert(!graph.containsEdge(source, dest));
+            assert(!graph.containsEdge(dest, source));
+        }
+    }
+    end_time = getMilliseconds();
+    cout << "3. removeEdge con " << numAristas / 2 << " aristas: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getEdgeCount() == numAristas - (numAristas / 2));
+
+    // 4. Prueba de removeVertex con muchos vértices
+    start_time = getMilliseconds();
+    for (int i = 0; i < numVertices / 2; ++i) { // Eliminar la mitad de los vértices
+        if (graph.containsVertex(i)) {
+            graph.removeVertex(i);
+            assert(!graph.containsVertex(i));
+        }
+    }
+    end_time = getMilliseconds();
+    cout << "4. removeVertex con " << numVertices / 2 << " vértices: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.getVertexCount() == numVertices - (numVertices / 2));
+
+    // 5. Prueba de clear
+    start_time = getMilliseconds();
+    graph.clear();
+    end_time = getMilliseconds();
+    cout << "5. clear: OK. Tiempo: " << end_time - start_time << " ms" << endl;
+    assert(graph.isEmpty());
+    assert(graph.getVertexCount() == 0);
+    assert(graph.getEdgeCount() == 0);
+
+    std::cout << "--- Fin de la Prueba de Estrés con Muchos Nodos (C++98) ---" << std::endl;
+
+    pruebaAddEdgeMasivo();
+    pruebaInstantaneaCsr();
+    pruebaPoolNodos();
+    pruebaEliminacionGemelas();
+    pruebaEstresDirigido();
+    pruebaCargaMasiva();
+    pruebaCopiaLineal();
+    pruebaTablaIndices();
+    pruebaAdyacenciaHibrida();
+    pruebaBfsDireccional();
+    pruebaCaminosMinimos();
+    pruebaComponentesConexas();
+    pruebaMatrizDensa();
+    pruebaArchivoBinario();
+    pruebaCargaListaAristas();
+    pruebaLectoresDiferidos();
+    pruebaPageRank();
+    pruebaReordenamiento();
+    pruebaAdyacenciaComprimida();
+    pruebaPesosGenericos();
+    pruebaBfsMultiOrigen();
+    pruebaTriangulosYNucleos();
+    pruebaBosqueGenerador();
+    pruebaIntermediacion();
+    pruebaFlujoMaximo();
+
+    return 0;
+}
+